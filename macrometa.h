@@ -1,10 +1,18 @@
 #ifndef MACROMETA_H
 #define MACROMETA_H
 
-#include "mcmt\arith\table.h"
-#include "mcmt\token\compare.h"
-#include "mcmt\token\sep.h"
+#include "mcmt/mcmt.h"
 
-#include "mcmt\mcmt.h"
+#include "mcmt/gen/soa.h"
+#include "mcmt/gen/split.h"
+#include "mcmt/gen/packed.h"
+#include "mcmt/gen/bitpack.h"
+#include "mcmt/gen/enum.h"
+#include "mcmt/gen/keyword.h"
+#include "mcmt/gen/dispatch.h"
+#include "mcmt/gen/specialize.h"
+#include "mcmt/gen/flat_map.h"
+#include "mcmt/gen/registry.h"
+#include "mcmt/gen/state_machine.h"
 
 #endif // !MACROMETA_H
@@ -0,0 +1,284 @@
+#ifndef MCMT_ARG_H
+#define MCMT_ARG_H
+
+#include "basic.h"
+#include "concat.h"
+#include "extn_impl_ovld.h"
+#include "bit_logic.h"
+
+/**********************************
+ * MCMT_ARG_H
+ * @brief Macros for Handling Arguments.
+ *********************************/
+#pragma region mcmt_arg
+
+/******** extracts fst, snd, trd args ********/
+#pragma region extracts_fst_snd_trd_args
+
+/**
+ * @brief Extracts the first argument from a list of arguments.
+ * @param _fst The first argument.
+ * @param ... The rest of the arguments (ignored).
+ * @return The first argument.
+ * @details This macro extracts and returns the first argument, `_fst`, from a list of arguments.
+ * For example, if used as `FST(a, b, c)`, it will result in `_fst` being `a`.
+ */
+#define FST(_fst, ...) _fst
+
+/**
+ * @brief Extracts the second argument from a list of arguments.
+ * @param fst The first argument (ignored).
+ * @param _snd The second argument.
+ * @param ... The rest of the arguments (ignored).
+ * @return The second argument.
+ * @details This macro extracts and returns the second argument, `_snd`, from a list of arguments.
+ * For example, if used as `SND(a, b, c)`, it will result in `_snd` being `b`.
+ */
+#define SND(fst, _snd, ...) _snd
+
+/**
+ * @brief Extracts the third argument from a list of arguments.
+ * @param fst The first argument (ignored).
+ * @param snd The second argument (ignored).
+ * @param _trd The third argument.
+ * @param ... The rest of the arguments (ignored).
+ * @return The third argument.
+ * @details This macro extracts and returns the third argument, `_trd`, from a list of arguments.
+ * For example, if used as `TRD(a, b, c, d)`, it will result in `_trd` being `c`.
+ */
+#define TRD(fst, snd, _trd, ...) _trd
+
+/**
+ * @brief Combines the first and second arguments into a comma-separated list.
+ * @param _fst The first argument.
+ * @param _snd The second argument.
+ * @param ... The rest of the arguments (ignored).
+ * @return A comma-separated list of the first and second arguments.
+ * @details This macro combines the first and second arguments, `_fst` and `_snd`, into a comma-separated list.
+ * For example, if used as `FST_SND(a, b, c)`, it will result in `_fst, _snd` being `a, b`.
+ */
+#define FST_SND(_fst, _snd, ...) _fst, _snd
+
+/**
+ * @brief Combines the second and third arguments into a comma-separated list.
+ * @param fst The first argument (ignored).
+ * @param _snd The second argument.
+ * @param _trd The third argument.
+ * @param ... The rest of the arguments (ignored).
+ * @return A comma-separated list of the second and third arguments.
+ * @details This macro combines the second and third arguments, `_snd` and `_trd`, into a comma-separated list.
+ * For example, if used as `SND_TRD(a, b, c, d)`, it will result in `_snd, _trd` being `b, c`.
+ */
+#define SND_TRD(fst, _snd, _trd, ...) _snd, _trd
+
+/**
+ * @brief Combines the first and third arguments into a comma-separated list.
+ * @param _fst The first argument.
+ * @param snd The second argument (ignored).
+ * @param _trd The third argument.
+ * @param ... The rest of the arguments (ignored).
+ * @return A comma-separated list of the first and third arguments.
+ * @details This macro combines the first and third arguments, `_fst` and `_trd`, into a comma-separated list.
+ * For example, if used as `FST_TRD(a, b, c, d)`, it will result in `_fst, _trd` being `a, c`.
+ */
+#define FST_TRD(_fst, snd, _trd, ...) _fst, _trd
+
+/**
+ * @brief Combines the first, second, and third arguments into a comma-separated list.
+ * @param _fst The first argument.
+ * @param _snd The second argument.
+ * @param _trd The third argument.
+ * @param ... The rest of the arguments (ignored).
+ * @details This macro combines the first, second, and third arguments, `_fst`, `_snd`, and `_trd`, into a comma-separated list.
+ * For example, if used as `FST_SND_TRD(a, b, c, d)`, it will result in `_fst, _snd, _trd` being `a, b, c`.
+ */
+#define FST_SND_TRD(_fst, _snd, _trd, ...) _fst, _snd, _trd
+
+#pragma endregion // extracts_fst_snd_trd_args
+/*------- extracts fst, snd, trd args -------*/
+
+/******** extracts_fst_snd_trd_rest_args ********/
+#pragma region extracts_fst_snd_trd_rest_args
+
+/**
+ * @brief Extracts the rest of the arguments after the first argument.
+ * @param fst The first argument (ignored).
+ * @param ... The rest of the arguments.
+ * @return The rest of the arguments, excluding the first one.
+ * @details This macro extracts and returns the rest of the arguments after the first argument.
+ * For example, if used as `FST_REST(a, b, c)`, it will result in `(b, c)`.
+ */
+#define FST_REST(fst, ...) __VA_ARGS__
+
+/**
+ * @brief Extracts the rest of the arguments after the second argument.
+ * @param _fst The first argument.
+ * @param snd The second argument (ignored).
+ * @param ... The rest of the arguments.
+ * @return The rest of the arguments, excluding the second one.
+ * @details This macro extracts and returns the rest of the arguments after the second argument.
+ * For example, if used as `SND_REST(a, b, c, d)`, it will result in `(a, c, d)`.
+ */
+#define SND_REST(_fst, snd, ...) _fst, __VA_ARGS__
+
+/**
+ * @brief Extracts the rest of the arguments after the third argument.
+ * @param _fst The first argument.
+ * @param _snd The second argument.
+ * @param trd The third argument (ignored).
+ * @param ... The rest of the arguments.
+ * @return The rest of the arguments, excluding the third one.
+ * @details This macro extracts and returns the rest of the arguments after the third argument.
+ * For example, if used as `TRD_REST(a, b, c, d, e)`, it will result in `(a, b, d, e)`.
+ */
+#define TRD_REST(_fst, _snd, trd, ...) _fst, _snd, __VA_ARGS__
+
+/**
+ * @brief Extracts the rest of the arguments after the first two arguments.
+ * @param fst The first argument (ignored).
+ * @param snd The second argument (ignored).
+ * @param ... The rest of the arguments.
+ * @return The rest of the arguments, excluding the first two.
+ * @details This macro extracts and returns the rest of the arguments after the first two arguments.
+ * For example, if used as `FST_SND_REST(a, b, c, d, e)`, it will result in `(c, d, e)`.
+ */
+#define FST_SND_REST(fst, snd, ...) __VA_ARGS__
+
+/**
+ * @brief Extracts the rest of the arguments after the second and third arguments.
+ * @param _fst The first argument.
+ * @param snd The second argument (ignored).
+ * @param trd The third argument (ignored).
+ * @param ... The rest of the arguments.
+ * @return The rest of the arguments, excluding the second and third ones.
+ * @details This macro extracts and returns the rest of the arguments after the second and third arguments.
+ * For example, if used as `SND_TRD_REST(a, b, c, d, e, f)`, it will result in `(a, d, e, f)`.
+ */
+#define SND_TRD_REST(_fst, snd, trd, ...) _fst, __VA_ARGS__
+
+/**
+ * @brief Extracts the rest of the arguments after the first and third arguments.
+ * @param fst The first argument (ignored).
+ * @param _snd The second argument.
+ * @param trd The third argument (ignored).
+ * @param ... The rest of the arguments.
+ * @return The rest of the arguments, excluding the first and third ones.
+ * @details This macro extracts and returns the rest of the arguments after the first and third arguments.
+ * For example, if used as `TRD_FST_REST(a, b, c, d, e, f)`, it will result in `(b, d, e, f)`.
+ */
+#define FST_TRD_REST(fst, _snd, trd, ...) _snd, __VA_ARGS__
+
+/**
+ * @brief Extracts the rest of the arguments after the first two arguments.
+ * @param fst The first argument (ignored).
+ * @param snd The second argument (ignored).
+ * @param trd The third argument (ignored).
+ * @param ... The rest of the arguments.
+ * @return The rest of the arguments, excluding the first two.
+ * @details This macro extracts and returns the rest of the arguments after the first two arguments.
+ * For example, if used as `FST_SND_TRD_REST(a, b, c, d, e, f)`, it will result in `(d, e, f)`.
+ */
+#define FST_SND_TRD_REST(fst, snd, trd, ...) __VA_ARGS__
+
+#pragma endregion // extracts_fst_snd_trd_rest_args
+/*------- extracts_fst_snd_trd_rest_args -------*/
+
+/******** MCMT_ARG_COUNT_H ********/
+/**
+ * @brief Macros for counting the number of arguments.
+ */
+#pragma region mcmt_arg_count
+
+// TODO(DevDasae): Research recursive parameter counting methods
+/**
+ * @brief Counts the number of arguments in a variadic argument list.
+ * @param ... The variadic arguments.
+ * @details This macro counts the number of arguments provided in a variadic argument list and returns the count as an integer.
+ * It uses a clever technique that leverages a recursive macro to count the arguments.
+ * For example, if used as `COUNT(a, b, c)`, it will result in `3`.
+ * At most 128 arguments are counted: 129 arguments result in the `MCMT_LIMIT_EXCEEDED_COUNT` sentinel
+ * (see `MCMT_LIMIT_EXCEEDED`), and longer lists in one of the arguments.
+ */
+#define COUNT(...) COUNT_UNEVAL(__VA_ARGS__, MCMT_LIMIT_EXCEEDED_COUNT, COUNT_INV_SEQ_N())
+/**
+ * @brief Helper macro to count the number of arguments in a variadic argument list.
+ * @param ... The variadic arguments.
+ * @details This macro is not meant to be used directly. It is used internally by `COUNT(...)`.
+ */
+#define COUNT_UNEVAL(...) COUNT_CHECK(__VA_ARGS__)
+/**
+ * @brief Helper macro to count the number of arguments in a variadic argument list.
+ * @param __129, __128, ... The numbered arguments.
+ * @details This macro is not meant to be used directly. It is used internally to generate the argument count.
+ */
+#define COUNT_CHECK(__129, __128, __127, __126, __125, __124, __123, __122, __121, __120, __119, __118, __117, __116, __115, __114, __113, __112, __111, __110, __109, __108, __107, __106, __105, __104, __103, __102, __101, __100, __99, __98, __97, __96, __95, __94, __93, __92, __91, __90, __89, __88, __87, __86, __85, __84, __83, __82, __81, __80, __79, __78, __77, __76, __75, __74, __73, __72, __71, __70, __69, __68, __67, __66, __65, __64, __63, __62, __61, __60, __59, __58, __57, __56, __55, __54, __53, __52, __51, __50, __49, __48, __47, __46, __45, __44, __43, __42, __41, __40, __39, __38, __37, __36, __35, __34, __33, __32, __31, __30, __29, __28, __27, __26, __25, __24, __23, __22, __21, __20, __19, __18, __17, __16, __15, __14, __13, __12, __11, __10, __9, __8, __7, __6, __5, __4, __3, __2, __1, __N, ...) __N
+/**
+ * @brief Generates a sequence of arguments for argument counting.
+ * @details This macro generates a sequence of arguments for argument counting.
+ * It is used internally by the `COUNT` macro.
+ */
+#define COUNT_INV_SEQ_N() \
+    128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, vararg when given 1
+
+/**
+ * @brief Counts the number of arguments in a variadic argument list, with a fast path for short lists.
+ * @param ... The variadic arguments.
+ * @details Unlike `COUNT`, this macro returns 0 for an empty argument list, and it only expands the 128-entry
+ * `COUNT_INV_SEQ_N` when more than 9 arguments are given. Shorter lists are counted by selecting a marker from a
+ * 9-entry sequence, and a single argument is then tested for emptiness.
+ * Neither test pastes the arguments, so any tokens (string literals, operators, ...) are accepted,
+ * as long as the 10th argument (and the single argument) is not a function-like macro that expands to a comma.
+ * For example, `COUNT_OPT()` results in `0` and `COUNT_OPT(a, "b", c + 1)` results in `3`.
+ */
+#define COUNT_OPT(...)                   __COUNT_OPT_SELECT(__COUNT_OPT_PICK_UNEVAL(__VA_ARGS__, __COUNT_OPT_MARK_SEQ_N()), __VA_ARGS__)
+#define __COUNT_OPT_SELECT(_Mark, ...)   OPER_IMPL_OVERLOAD_UNARY(COUNT_OPT_SELECT_, __COUNT_OPT_HAS_COMMA(_Mark()))(_Mark, __VA_ARGS__)
+#define __COUNT_OPT_SELECT_0(_Mark, ...) COUNT(__VA_ARGS__)
+#define __COUNT_OPT_SELECT_1(_Mark, ...) OPER_IMPL_OVERLOAD_UNARY(COUNT_OPT_, __COUNT_OPT_MARK_VALUE(_Mark()))(__VA_ARGS__)
+#define __COUNT_OPT_9(...)               9
+#define __COUNT_OPT_8(...)               8
+#define __COUNT_OPT_7(...)               7
+#define __COUNT_OPT_6(...)               6
+#define __COUNT_OPT_5(...)               5
+#define __COUNT_OPT_4(...)               4
+#define __COUNT_OPT_3(...)               3
+#define __COUNT_OPT_2(...)               2
+#define __COUNT_OPT_1(...)               BIT_CMPL(__COUNT_OPT_IS_EMPTY(__VA_ARGS__))
+#define __COUNT_OPT_PICK_UNEVAL(...)     __COUNT_OPT_PICK(__VA_ARGS__)
+#define __COUNT_OPT_PICK(__1, __2, __3, __4, __5, __6, __7, __8, __9, _N, ...) _N
+
+/* the picked entry is one of these markers only if at most 9 arguments were given, otherwise it is a user argument */
+#define __COUNT_OPT_MARK_SEQ_N() \
+    __COUNT_OPT_MARK_9, __COUNT_OPT_MARK_8, __COUNT_OPT_MARK_7, __COUNT_OPT_MARK_6, __COUNT_OPT_MARK_5, __COUNT_OPT_MARK_4, __COUNT_OPT_MARK_3, __COUNT_OPT_MARK_2, __COUNT_OPT_MARK_1, ~
+#define __COUNT_OPT_MARK_9(...)          ~, 9
+#define __COUNT_OPT_MARK_8(...)          ~, 8
+#define __COUNT_OPT_MARK_7(...)          ~, 7
+#define __COUNT_OPT_MARK_6(...)          ~, 6
+#define __COUNT_OPT_MARK_5(...)          ~, 5
+#define __COUNT_OPT_MARK_4(...)          ~, 4
+#define __COUNT_OPT_MARK_3(...)          ~, 3
+#define __COUNT_OPT_MARK_2(...)          ~, 2
+#define __COUNT_OPT_MARK_1(...)          ~, 1
+#define __COUNT_OPT_MARK_VALUE(...)      __COUNT_OPT_MARK_VALUE_IMPL(__VA_ARGS__)
+#define __COUNT_OPT_MARK_VALUE_IMPL(_Tilde, _N) _N
+
+/* a single argument is empty only if none of the four probes below sees a comma except the last one */
+#define __COUNT_OPT_IS_EMPTY(...)                                                                      \
+    __COUNT_OPT_IS_EMPTY_CASE(                                                                         \
+        __COUNT_OPT_HAS_COMMA(__VA_ARGS__), __COUNT_OPT_HAS_COMMA(__COUNT_OPT_TRIGGER __VA_ARGS__),    \
+        __COUNT_OPT_HAS_COMMA(__VA_ARGS__()), __COUNT_OPT_HAS_COMMA(__COUNT_OPT_TRIGGER __VA_ARGS__()) \
+    )
+#define __COUNT_OPT_IS_EMPTY_CASE(_a, _b, _c, _d) __COUNT_OPT_HAS_COMMA(CONCAT5(__COUNT_OPT_IS_EMPTY_CASE_, _a, _b, _c, _d))
+#define __COUNT_OPT_IS_EMPTY_CASE_0001            ,
+#define __COUNT_OPT_TRIGGER(...)                  ,
+#define __COUNT_OPT_HAS_COMMA(...)                __COUNT_OPT_PICK(__VA_ARGS__, 1, 1, 1, 1, 1, 1, 1, 1, 0, ~)
+
+#pragma endregion // mcmt_arg_count
+/*------- MCMT_ARG_COUNT_H -------*/
+
+#define REPLACE_REST(...) __VA_ARGS__) IGNORE(
+#define REPLACE_REST_TO_ENCLOSED(_ArgsEnclosed) UNCLOSE(_ArgsEnclosed)) IGNORE(
+
+#pragma endregion // mcmt_arg
+/*--------------------------------*/
+
+#endif // !MCMT_ARG_H
@@ -0,0 +1,208 @@
+#ifndef MCMT_ARITH_H
+#define MCMT_ARITH_H
+
+#include "basic.h"
+#include "concat.h"
+#include "extn_impl_ovld.h"
+#include "arg.h"
+#include "recur.h"
+#include "bit_logic.h"
+#include "logic.h"
+#include "limit.h"
+#include "arith/table.h"
+
+/*********************************
+ * MCMT_ARITH_H
+ *********************************/
+#pragma region mcmt_arith
+
+/******** MCMT_ARITH_BASIC_H ********/
+#pragma region mcmt_arith_basic
+
+// TODO(DevDasae): Implement return of actual integer literal for N{number}
+// NOTE: Negative numbers are handled by the INT_ macros of mcmt/arith/signed.h, on top of the unsigned ones below
+
+/* increase */
+#define INC(_N) OPER_IMPL_OVERLOAD_UNARY_UNEVAL(INC_, _N)
+
+/* decrease */
+#define DEC(_N) OPER_IMPL_OVERLOAD_UNARY_UNEVAL(DEC_, _N)
+
+/* INC past the table, and the sentinel kept by the next steps (see MCMT_LIMIT_EXCEEDED) */
+#define __INC_256                     MCMT_LIMIT_EXCEEDED(INC, "mcmt: INC exceeds MCMT_ARITH_MAX (256)")
+#define __INC_MCMT_LIMIT_EXCEEDED_INC MCMT_LIMIT_EXCEEDED_INC
+#define __DEC_MCMT_LIMIT_EXCEEDED_INC MCMT_LIMIT_EXCEEDED_INC
+
+#pragma endregion // mcmt_arith_basic
+/*------- MCMT_ARITH_BASIC_H -------*/
+
+/**
+ * Q: Why are the EVALs below redefined even though they already exist?
+ * A: We've found that when macros that use loops/recursion are nested,
+ * i.e. when a parent recursive macro contains a child recursive macro that uses an EVAL to return a result,
+ * the parent EVAL extension of the EVAL level being used by the child recursive macro must be defined separately.
+ *
+ * If the parent recursive macro and the child recursive macro use the same level of EVAL, you will see the following result.
+ * `EVAL(EVAL(EVAL(EVAL(EVAL(EVAL(EVAL(...({return value})...)`
+ */
+
+#define ARITH_L0_EVAL(...)       ARITH_L0_EVAL_LIMIT(__VA_ARGS__)
+#define ARITH_L0_EVAL0(...)      __VA_ARGS__
+#define ARITH_L0_EVAL1(...)      ARITH_L0_EVAL0(__VA_ARGS__)
+#define ARITH_L0_EVAL2(...)      ARITH_L0_EVAL1(ARITH_L0_EVAL1(__VA_ARGS__))
+#define ARITH_L0_EVAL3(...)      ARITH_L0_EVAL2(ARITH_L0_EVAL2(__VA_ARGS__))
+#define ARITH_L0_EVAL4(...)      ARITH_L0_EVAL3(ARITH_L0_EVAL3(__VA_ARGS__))
+#define ARITH_L0_EVAL5(...)      ARITH_L0_EVAL4(ARITH_L0_EVAL4(__VA_ARGS__))
+#define ARITH_L0_EVAL6(...)      ARITH_L0_EVAL5(ARITH_L0_EVAL5(__VA_ARGS__))
+#define ARITH_L0_EVAL7(...)      ARITH_L0_EVAL6(ARITH_L0_EVAL6(__VA_ARGS__))
+#define ARITH_L0_EVAL_LIMIT(...) ARITH_L0_EVAL7(ARITH_L0_EVAL7(__VA_ARGS__))
+
+#define ARITH_L1_EVAL(...)       ARITH_L1_EVAL_LIMIT(__VA_ARGS__)
+#define ARITH_L1_EVAL0(...)      __VA_ARGS__
+#define ARITH_L1_EVAL1(...)      ARITH_L1_EVAL0(__VA_ARGS__)
+#define ARITH_L1_EVAL2(...)      ARITH_L1_EVAL1(ARITH_L1_EVAL1(__VA_ARGS__))
+#define ARITH_L1_EVAL3(...)      ARITH_L1_EVAL2(ARITH_L1_EVAL2(__VA_ARGS__))
+#define ARITH_L1_EVAL4(...)      ARITH_L1_EVAL3(ARITH_L1_EVAL3(__VA_ARGS__))
+#define ARITH_L1_EVAL5(...)      ARITH_L1_EVAL4(ARITH_L1_EVAL4(__VA_ARGS__))
+#define ARITH_L1_EVAL6(...)      ARITH_L1_EVAL5(ARITH_L1_EVAL5(__VA_ARGS__))
+#define ARITH_L1_EVAL7(...)      ARITH_L1_EVAL6(ARITH_L1_EVAL6(__VA_ARGS__))
+#define ARITH_L1_EVAL_LIMIT(...) ARITH_L1_EVAL7(ARITH_L1_EVAL7(__VA_ARGS__))
+
+#define ARITH_L2_EVAL(...)       ARITH_L2_EVAL_LIMIT(__VA_ARGS__)
+#define ARITH_L2_EVAL0(...)      __VA_ARGS__
+#define ARITH_L2_EVAL1(...)      ARITH_L2_EVAL0(__VA_ARGS__)
+#define ARITH_L2_EVAL2(...)      ARITH_L2_EVAL1(ARITH_L2_EVAL1(__VA_ARGS__))
+#define ARITH_L2_EVAL3(...)      ARITH_L2_EVAL2(ARITH_L2_EVAL2(__VA_ARGS__))
+#define ARITH_L2_EVAL4(...)      ARITH_L2_EVAL3(ARITH_L2_EVAL3(__VA_ARGS__))
+#define ARITH_L2_EVAL5(...)      ARITH_L2_EVAL4(ARITH_L2_EVAL4(__VA_ARGS__))
+#define ARITH_L2_EVAL6(...)      ARITH_L2_EVAL5(ARITH_L2_EVAL5(__VA_ARGS__))
+#define ARITH_L2_EVAL7(...)      ARITH_L2_EVAL6(ARITH_L2_EVAL6(__VA_ARGS__))
+#define ARITH_L2_EVAL_LIMIT(...) ARITH_L2_EVAL7(ARITH_L2_EVAL7(__VA_ARGS__))
+
+#define ARITH_L3_EVAL(...)       ARITH_L3_EVAL_LIMIT(__VA_ARGS__)
+#define ARITH_L3_EVAL0(...)      __VA_ARGS__
+#define ARITH_L3_EVAL1(...)      ARITH_L3_EVAL0(__VA_ARGS__)
+#define ARITH_L3_EVAL2(...)      ARITH_L3_EVAL1(ARITH_L3_EVAL1(__VA_ARGS__))
+#define ARITH_L3_EVAL3(...)      ARITH_L3_EVAL2(ARITH_L3_EVAL2(__VA_ARGS__))
+#define ARITH_L3_EVAL4(...)      ARITH_L3_EVAL3(ARITH_L3_EVAL3(__VA_ARGS__))
+#define ARITH_L3_EVAL5(...)      ARITH_L3_EVAL4(ARITH_L3_EVAL4(__VA_ARGS__))
+#define ARITH_L3_EVAL6(...)      ARITH_L3_EVAL5(ARITH_L3_EVAL5(__VA_ARGS__))
+#define ARITH_L3_EVAL7(...)      ARITH_L3_EVAL6(ARITH_L3_EVAL6(__VA_ARGS__))
+#define ARITH_L3_EVAL_LIMIT(...) ARITH_L3_EVAL7(ARITH_L3_EVAL7(__VA_ARGS__))
+
+/* add */
+#define ADD(_A, _N) ARITH_L0_EVAL(ADD_UNEVAL(_A, _N))
+#define ADD_UNEVAL(_A, _N) IF_LAZY(IS_NOT_ZERO(_N))(__ADD_STEP, FST)(_A, _N)
+#define __ADD_STEP(_A, _N) DEFER(ADD_INDIRECT)()(INC(_A), DEC(_N))
+#define ADD_INDIRECT()     ADD_UNEVAL
+
+/* subtract, saturating at 0 */
+#define SUB(_A, _N) ARITH_L0_EVAL(SUB_UNEVAL(_A, _N))
+#define SUB_UNEVAL(_A, _N) IF_LAZY(IS_NOT_ZERO(_N))(__SUB_STEP, FST)(_A, _N)
+#define __SUB_STEP(_A, _N) DEFER(SUB_INDIRECT)()(DEC(_A), DEC(_N))
+#define SUB_INDIRECT()     SUB_UNEVAL
+
+/* multiply */
+#define MUL(_A, _N) ARITH_L1_EVAL(MUL_UNEVAL(_A, _N, 0))
+#define MUL_UNEVAL(_A, _N, _SUM) IF_LAZY(IS_NOT_ZERO(_N))(__MUL_STEP, TRD)(_A, _N, _SUM)
+#define __MUL_STEP(_A, _N, _SUM) DEFER(MUL_INDIRECT)()(_A, DEC(_N), ADD(_SUM, _A))
+#define MUL_INDIRECT()           MUL_UNEVAL
+
+/* divide, rounding down; dividing by 0 produces MCMT_LIMIT_EXCEEDED_DIV_BY_ZERO. ARITH_L1_EVAL defines QUOTIENT range */
+#define DIV(_A, _N)        ARITH_L1_EVAL(IF_LAZY(IS_ZERO(_N))(__DIV_BY_ZERO, DIV_UNEVAL)(_A, _N, 0, _A))
+#define __DIV_BY_ZERO(...) MCMT_LIMIT_EXCEEDED(DIV_BY_ZERO, "mcmt: DIV by 0")
+#define DIV_UNEVAL(_A, _N, _QUOTIENT, _REMAINDER) \
+    IF_LAZY(LESS(_REMAINDER, _N))(__DIV_DONE, __DIV_STEP)(_A, _N, _QUOTIENT, _REMAINDER)
+#define __DIV_DONE(_A, _N, _QUOTIENT, _REMAINDER) CMP_EXCEEDED_OR(LESS(_REMAINDER, _N), _QUOTIENT)
+#define __DIV_STEP(_A, _N, _QUOTIENT, _REMAINDER) \
+    DEFER(DIV_INDIRECT)()(_A, _N, INC(_QUOTIENT), SUB(_REMAINDER, _N))
+#define DIV_INDIRECT() DIV_UNEVAL
+
+/* binominal */
+#define BINOM(_N, _K) ARITH_L2_EVAL(BINOM_UNEVAL(_N, _K, 1, 1)) /* ARITH_L2_EVAL defines max K */
+#define BINOM_UNEVAL(_N, _K, _NUMER, _DENOM) \
+    IF_LAZY(IS_NOT_ZERO(_K))(__BINOM_STEP, __BINOM_DONE)(_N, _K, _NUMER, _DENOM)
+#define __BINOM_STEP(_N, _K, _NUMER, _DENOM) \
+    DEFER(BINOM_INDIRECT)()(DEC(_N), DEC(_K), MUL(_NUMER, _N), MUL(_DENOM, _K))
+#define __BINOM_DONE(_N, _K, _NUMER, _DENOM) DIV(_NUMER, _DENOM)
+#define BINOM_INDIRECT()                     BINOM_UNEVAL
+
+/******** MCMT_ARITH_COMPARE_H ********/
+#pragma region mcmt_arith_compare
+
+/**
+ * @brief Compares two numbers.
+ * @param _a The first number.
+ * @param _b The second number.
+ * @return `LT`, `EQ` or `GT`.
+ * @details Unlike `SUB`-based comparison, this macro does not recurse. Both numbers are split into their
+ * decimal digits through the `__DIGITS_{n}` table, and the digits are compared from the most significant one
+ * through the `__DIGIT_CMP_{x}{y}` table, so the comparison expands in constant depth.
+ * An operand holding the `INC` sentinel results in that sentinel, and an operand missing from the table, e.g. `300`,
+ * in `MCMT_LIMIT_EXCEEDED_CMP` (see `MCMT_LIMIT_EXCEEDED`).
+ * For example, `CMP(4, 16)` results in `LT`.
+ */
+#define CMP(_a, _b)                                CMP_UNEVAL(DIGITS(_a), DIGITS(_b))
+#define CMP_UNEVAL(_DigitsA, _DigitsB)             __CMP_SELECT(UNCLOSE(_DigitsA), UNCLOSE(_DigitsB))
+#define __CMP_DIGITS_EXPAND(_OP, _Args)            _OP _Args
+#define __CMP_DIGITS(_a2, _a1, _a0, _b2, _b1, _b0) __CMP_CHAIN(DIGIT_CMP(_a2, _b2), __CMP_CHAIN(DIGIT_CMP(_a1, _b1), DIGIT_CMP(_a0, _b0)))
+
+/* the digits of both operands, picked by their count: 3 per number, 4 for the INC sentinel, 1 off the table */
+#define __CMP_SELECT(...)                                                                                              \
+    __CMP_DIGITS_EXPAND(__CMP_PICK(__VA_ARGS__, __CMP_EXCEEDED_INC, __CMP_EXCEEDED_INC, __CMP_DIGITS,                  \
+                                   __CMP_EXCEEDED_CMP, __CMP_EXCEEDED_CMP, __CMP_EXCEEDED_CMP, __CMP_EXCEEDED_CMP, ~), \
+                        (__VA_ARGS__))
+#define __CMP_PICK(_1, _2, _3, _4, _5, _6, _7, _8, _OP, ...) _OP
+/* the report of a sentinel trails it into the 4th of its digits, which are dropped, so the sentinel is made again */
+#define __DIGITS_MCMT_LIMIT_EXCEEDED_INC (~, ~, ~, )
+#define __CMP_EXCEEDED_INC(...)          __INC_256
+#define __CMP_EXCEEDED_CMP(...)          MCMT_LIMIT_EXCEEDED(CMP, "mcmt: CMP operand exceeds MCMT_ARITH_MAX (256)")
+
+/* the most significant non-equal digit decides */
+#define __CMP_CHAIN(_Hi, _Lo) OPER_IMPL_OVERLOAD_UNARY(CMP_CHAIN_, _Hi)(_Lo)
+#define __CMP_CHAIN_LT(_Lo)   LT
+#define __CMP_CHAIN_EQ(_Lo)   _Lo
+#define __CMP_CHAIN_GT(_Lo)   GT
+
+#define DIGITS(_N)           OPER_IMPL_OVERLOAD_UNARY_UNEVAL(DIGITS_, _N)
+#define DIGIT_CMP(_x, _y)    OPER_IMPL_OVERLOAD_BINARY_UNEVAL(DIGIT_CMP_, _x, _y)
+
+/* return 1 if the relation holds, otherwise 0, or the sentinel CMP gave, which IF and IF_LAZY take as true */
+#define LESS(_a, _b)                      OPER_IMPL_OVERLOAD_UNARY(LESS_, CMP(_a, _b))
+#define __LESS_LT                         1
+#define __LESS_EQ                         0
+#define __LESS_GT                         0
+#define __LESS_MCMT_LIMIT_EXCEEDED_INC    MCMT_LIMIT_EXCEEDED_INC
+#define __LESS_MCMT_LIMIT_EXCEEDED_CMP    MCMT_LIMIT_EXCEEDED_CMP
+#define LESS_EQ(_a, _b)                   OPER_IMPL_OVERLOAD_UNARY(LESS_EQ_, CMP(_a, _b))
+#define __LESS_EQ_LT                      1
+#define __LESS_EQ_EQ                      1
+#define __LESS_EQ_GT                      0
+#define __LESS_EQ_MCMT_LIMIT_EXCEEDED_INC MCMT_LIMIT_EXCEEDED_INC
+#define __LESS_EQ_MCMT_LIMIT_EXCEEDED_CMP MCMT_LIMIT_EXCEEDED_CMP
+#define GREATER(_a, _b)                   LESS(_b, _a)
+#define GREATER_EQ(_a, _b)                LESS_EQ(_b, _a)
+
+/**
+ * @brief Passes on the sentinel a relation gave (see `MCMT_LIMIT_EXCEEDED`).
+ * @param _Rel The result of a relation, e.g. `LESS`.
+ * @param _Else The result when `_Rel` is `0` or `1`.
+ * @details A loop stopping on a relation uses it for its result, so an operand past the table stops the loop with
+ * the sentinel instead of a number. For example, `CMP_EXCEEDED_OR(LESS(300, 2), 0)` results in
+ * `MCMT_LIMIT_EXCEEDED_CMP`.
+ */
+#define CMP_EXCEEDED_OR(_Rel, _Else)              __CMP_EXCEEDED_OR_PICK(OPER_IMPL_OVERLOAD_UNARY(CMP_EXCEEDED_OR_, _Rel), _Else, ~)
+#define __CMP_EXCEEDED_OR_PICK(...)               SND(__VA_ARGS__)
+#define __CMP_EXCEEDED_OR_MCMT_LIMIT_EXCEEDED_INC ~, MCMT_LIMIT_EXCEEDED_INC
+#define __CMP_EXCEEDED_OR_MCMT_LIMIT_EXCEEDED_CMP ~, MCMT_LIMIT_EXCEEDED_CMP
+
+#define MIN(_a, _b) BIT_IF(LESS(_b, _a), _b, _a)
+#define MAX(_a, _b) BIT_IF(LESS(_a, _b), _b, _a)
+
+#pragma endregion // mcmt_arith_compare
+/*------- MCMT_ARITH_COMPARE_H -------*/
+
+#pragma endregion // mcmt_arith
+/*-------------------------------*/
+
+#endif // !MCMT_ARITH_H
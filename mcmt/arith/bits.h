@@ -0,0 +1,102 @@
+#ifndef MCMT_ARITH_BITS_H
+#define MCMT_ARITH_BITS_H
+
+#include "../extn_impl_ovld.h"
+#include "../bit_logic.h"
+#include "../arith.h"
+#include "bits_table.h"
+
+/**********************************
+ * MCMT_ARITH_BITS_H
+ * @brief Macros for bit operations on numbers.
+ *********************************/
+#pragma region mcmt_arith_bits
+
+/**
+ * @brief Bit operations on numbers in [0, MCMT_ARITH_BITS_MAX].
+ * @details None of these macros recurse. A number is split into its 9 binary digits through the `__BITS_{n}` table,
+ * the digits are combined with the single-bit operations, and the result is read back through the `__BITS_NUM_{bits}`
+ * table, or the answer is looked up directly, so each of them expands in constant depth to a decimal literal.
+ * This lets sizes and masks be derived from one tunable constant, e.g.
+ * @code
+ * #define RING_CAP  NEXT_POW2(RING_MIN) // 100 -> 128
+ * #define RING_MASK DEC(RING_CAP)       // 127
+ * #define RING_BITS LOG2(RING_CAP)      // 7
+ * @endcode
+ */
+#define BITS(_N)        OPER_IMPL_OVERLOAD_UNARY_UNEVAL(BITS_, _N)
+#define POPCOUNT(_N)    OPER_IMPL_OVERLOAD_UNARY_UNEVAL(POPCOUNT_, _N)
+#define LOG2(_N)        OPER_IMPL_OVERLOAD_UNARY_UNEVAL(LOG2_, _N)
+#define NEXT_POW2(_N)   OPER_IMPL_OVERLOAD_UNARY_UNEVAL(NEXT_POW2_, _N)
+#define IS_POW2(_N)     OPER_IMPL_OVERLOAD_UNARY(IS_POW2_, POPCOUNT(_N))
+#define __IS_POW2_0     0
+#define __IS_POW2_1     1
+#define __IS_POW2_2     0
+#define __IS_POW2_3     0
+#define __IS_POW2_4     0
+#define __IS_POW2_5     0
+#define __IS_POW2_6     0
+#define __IS_POW2_7     0
+#define __IS_POW2_8     0
+#define __IS_POW2_9     0
+
+/* bitwise operations, combining the binary digits of both numbers pairwise */
+#define BITAND(_a, _b) __BITS_ZIP(BIT_AND, BITS(_a), BITS(_b))
+#define BITOR(_a, _b)  __BITS_ZIP(BIT_OR, BITS(_a), BITS(_b))
+#define BITXOR(_a, _b) __BITS_ZIP(BIT_XOR, BITS(_a), BITS(_b))
+
+/**
+ * @brief Shifts a number left or right by `_n` bits.
+ * @param _a The number.
+ * @param _n The shift amount, a literal in [0, 8].
+ * @details `SHL` is defined as long as the result fits in [0, MCMT_ARITH_BITS_MAX]. Otherwise a shifted-out digit is 1
+ * and the expansion stops at an undefined `__BITS_FIT_{bits}(...)` call, which the compiler reports.
+ * For example, `SHL(3, 4)` results in `48` and `SHR(48, 3)` results in `6`.
+ */
+#define SHL(_a, _n) __BITS_EXPAND(CONCAT(__SHL_, _n), (UNCLOSE(BITS(_a))))
+#define SHR(_a, _n) __BITS_EXPAND(CONCAT(__SHR_, _n), (UNCLOSE(BITS(_a))))
+
+#define __BITS_EXPAND(_OP, _Args) _OP _Args
+#define __BITS_NUM(...)           __BITS_NUM_PASTE(__VA_ARGS__)
+#define __BITS_NUM_PASTE(_b8, _b7, _b6, _b5, _b4, _b3, _b2, _b1, _b0) \
+    __BITS_NUM_##_b8##_b7##_b6##_b5##_b4##_b3##_b2##_b1##_b0
+
+#define __BITS_ZIP(_OP, _BitsA, _BitsB) __BITS_EXPAND(__BITS_ZIP_IMPL, (_OP, UNCLOSE(_BitsA), UNCLOSE(_BitsB)))
+#define __BITS_ZIP_IMPL(_OP, _a8, _a7, _a6, _a5, _a4, _a3, _a2, _a1, _a0, _b8, _b7, _b6, _b5, _b4, _b3, _b2, _b1, _b0) \
+    __BITS_NUM(_OP(_a8, _b8), _OP(_a7, _b7), _OP(_a6, _b6), _OP(_a5, _b5), _OP(_a4, _b4), _OP(_a3, _b3), _OP(_a2, _b2), _OP(_a1, _b1), _OP(_a0, _b0))
+
+/* the digits shifted out of SHL must all be 0 */
+#define __BITS_FIT_(_N)         _N
+#define __BITS_FIT_0(_N)        _N
+#define __BITS_FIT_00(_N)       _N
+#define __BITS_FIT_000(_N)      _N
+#define __BITS_FIT_0000(_N)     _N
+#define __BITS_FIT_00000(_N)    _N
+#define __BITS_FIT_000000(_N)   _N
+#define __BITS_FIT_0000000(_N)  _N
+#define __BITS_FIT_00000000(_N) _N
+
+#define __SHL_0(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_(__BITS_NUM(_8, _7, _6, _5, _4, _3, _2, _1, _0))
+#define __SHL_1(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_##_8(__BITS_NUM(_7, _6, _5, _4, _3, _2, _1, _0, 0))
+#define __SHL_2(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_##_8##_7(__BITS_NUM(_6, _5, _4, _3, _2, _1, _0, 0, 0))
+#define __SHL_3(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_##_8##_7##_6(__BITS_NUM(_5, _4, _3, _2, _1, _0, 0, 0, 0))
+#define __SHL_4(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_##_8##_7##_6##_5(__BITS_NUM(_4, _3, _2, _1, _0, 0, 0, 0, 0))
+#define __SHL_5(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_##_8##_7##_6##_5##_4(__BITS_NUM(_3, _2, _1, _0, 0, 0, 0, 0, 0))
+#define __SHL_6(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_##_8##_7##_6##_5##_4##_3(__BITS_NUM(_2, _1, _0, 0, 0, 0, 0, 0, 0))
+#define __SHL_7(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_##_8##_7##_6##_5##_4##_3##_2(__BITS_NUM(_1, _0, 0, 0, 0, 0, 0, 0, 0))
+#define __SHL_8(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_FIT_##_8##_7##_6##_5##_4##_3##_2##_1(__BITS_NUM(_0, 0, 0, 0, 0, 0, 0, 0, 0))
+
+#define __SHR_0(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(_8, _7, _6, _5, _4, _3, _2, _1, _0)
+#define __SHR_1(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(0, _8, _7, _6, _5, _4, _3, _2, _1)
+#define __SHR_2(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(0, 0, _8, _7, _6, _5, _4, _3, _2)
+#define __SHR_3(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(0, 0, 0, _8, _7, _6, _5, _4, _3)
+#define __SHR_4(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(0, 0, 0, 0, _8, _7, _6, _5, _4)
+#define __SHR_5(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(0, 0, 0, 0, 0, _8, _7, _6, _5)
+#define __SHR_6(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(0, 0, 0, 0, 0, 0, _8, _7, _6)
+#define __SHR_7(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(0, 0, 0, 0, 0, 0, 0, _8, _7)
+#define __SHR_8(_8, _7, _6, _5, _4, _3, _2, _1, _0) __BITS_NUM(0, 0, 0, 0, 0, 0, 0, 0, _8)
+
+#pragma endregion // mcmt_arith_bits
+/*-------------------------------*/
+
+#endif // !MCMT_ARITH_BITS_H
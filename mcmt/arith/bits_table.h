@@ -0,0 +1,2578 @@
+#ifndef MCMT_ARITH_BITS_TABLE_H
+#define MCMT_ARITH_BITS_TABLE_H
+
+/* MCMT_ARITH_BITS_TABLES */
+
+/* MCMT_ARITH_BITS_TABLE_RANGE: the bit tables are defined on [0, MCMT_ARITH_BITS_MAX] */
+#define MCMT_ARITH_BITS_MAX 511
+
+/* binary digits (9 bits, most significant first) */
+#define __BITS_0   (0, 0, 0, 0, 0, 0, 0, 0, 0)
+#define __BITS_1   (0, 0, 0, 0, 0, 0, 0, 0, 1)
+#define __BITS_2   (0, 0, 0, 0, 0, 0, 0, 1, 0)
+#define __BITS_3   (0, 0, 0, 0, 0, 0, 0, 1, 1)
+#define __BITS_4   (0, 0, 0, 0, 0, 0, 1, 0, 0)
+#define __BITS_5   (0, 0, 0, 0, 0, 0, 1, 0, 1)
+#define __BITS_6   (0, 0, 0, 0, 0, 0, 1, 1, 0)
+#define __BITS_7   (0, 0, 0, 0, 0, 0, 1, 1, 1)
+#define __BITS_8   (0, 0, 0, 0, 0, 1, 0, 0, 0)
+#define __BITS_9   (0, 0, 0, 0, 0, 1, 0, 0, 1)
+#define __BITS_10  (0, 0, 0, 0, 0, 1, 0, 1, 0)
+#define __BITS_11  (0, 0, 0, 0, 0, 1, 0, 1, 1)
+#define __BITS_12  (0, 0, 0, 0, 0, 1, 1, 0, 0)
+#define __BITS_13  (0, 0, 0, 0, 0, 1, 1, 0, 1)
+#define __BITS_14  (0, 0, 0, 0, 0, 1, 1, 1, 0)
+#define __BITS_15  (0, 0, 0, 0, 0, 1, 1, 1, 1)
+#define __BITS_16  (0, 0, 0, 0, 1, 0, 0, 0, 0)
+#define __BITS_17  (0, 0, 0, 0, 1, 0, 0, 0, 1)
+#define __BITS_18  (0, 0, 0, 0, 1, 0, 0, 1, 0)
+#define __BITS_19  (0, 0, 0, 0, 1, 0, 0, 1, 1)
+#define __BITS_20  (0, 0, 0, 0, 1, 0, 1, 0, 0)
+#define __BITS_21  (0, 0, 0, 0, 1, 0, 1, 0, 1)
+#define __BITS_22  (0, 0, 0, 0, 1, 0, 1, 1, 0)
+#define __BITS_23  (0, 0, 0, 0, 1, 0, 1, 1, 1)
+#define __BITS_24  (0, 0, 0, 0, 1, 1, 0, 0, 0)
+#define __BITS_25  (0, 0, 0, 0, 1, 1, 0, 0, 1)
+#define __BITS_26  (0, 0, 0, 0, 1, 1, 0, 1, 0)
+#define __BITS_27  (0, 0, 0, 0, 1, 1, 0, 1, 1)
+#define __BITS_28  (0, 0, 0, 0, 1, 1, 1, 0, 0)
+#define __BITS_29  (0, 0, 0, 0, 1, 1, 1, 0, 1)
+#define __BITS_30  (0, 0, 0, 0, 1, 1, 1, 1, 0)
+#define __BITS_31  (0, 0, 0, 0, 1, 1, 1, 1, 1)
+#define __BITS_32  (0, 0, 0, 1, 0, 0, 0, 0, 0)
+#define __BITS_33  (0, 0, 0, 1, 0, 0, 0, 0, 1)
+#define __BITS_34  (0, 0, 0, 1, 0, 0, 0, 1, 0)
+#define __BITS_35  (0, 0, 0, 1, 0, 0, 0, 1, 1)
+#define __BITS_36  (0, 0, 0, 1, 0, 0, 1, 0, 0)
+#define __BITS_37  (0, 0, 0, 1, 0, 0, 1, 0, 1)
+#define __BITS_38  (0, 0, 0, 1, 0, 0, 1, 1, 0)
+#define __BITS_39  (0, 0, 0, 1, 0, 0, 1, 1, 1)
+#define __BITS_40  (0, 0, 0, 1, 0, 1, 0, 0, 0)
+#define __BITS_41  (0, 0, 0, 1, 0, 1, 0, 0, 1)
+#define __BITS_42  (0, 0, 0, 1, 0, 1, 0, 1, 0)
+#define __BITS_43  (0, 0, 0, 1, 0, 1, 0, 1, 1)
+#define __BITS_44  (0, 0, 0, 1, 0, 1, 1, 0, 0)
+#define __BITS_45  (0, 0, 0, 1, 0, 1, 1, 0, 1)
+#define __BITS_46  (0, 0, 0, 1, 0, 1, 1, 1, 0)
+#define __BITS_47  (0, 0, 0, 1, 0, 1, 1, 1, 1)
+#define __BITS_48  (0, 0, 0, 1, 1, 0, 0, 0, 0)
+#define __BITS_49  (0, 0, 0, 1, 1, 0, 0, 0, 1)
+#define __BITS_50  (0, 0, 0, 1, 1, 0, 0, 1, 0)
+#define __BITS_51  (0, 0, 0, 1, 1, 0, 0, 1, 1)
+#define __BITS_52  (0, 0, 0, 1, 1, 0, 1, 0, 0)
+#define __BITS_53  (0, 0, 0, 1, 1, 0, 1, 0, 1)
+#define __BITS_54  (0, 0, 0, 1, 1, 0, 1, 1, 0)
+#define __BITS_55  (0, 0, 0, 1, 1, 0, 1, 1, 1)
+#define __BITS_56  (0, 0, 0, 1, 1, 1, 0, 0, 0)
+#define __BITS_57  (0, 0, 0, 1, 1, 1, 0, 0, 1)
+#define __BITS_58  (0, 0, 0, 1, 1, 1, 0, 1, 0)
+#define __BITS_59  (0, 0, 0, 1, 1, 1, 0, 1, 1)
+#define __BITS_60  (0, 0, 0, 1, 1, 1, 1, 0, 0)
+#define __BITS_61  (0, 0, 0, 1, 1, 1, 1, 0, 1)
+#define __BITS_62  (0, 0, 0, 1, 1, 1, 1, 1, 0)
+#define __BITS_63  (0, 0, 0, 1, 1, 1, 1, 1, 1)
+#define __BITS_64  (0, 0, 1, 0, 0, 0, 0, 0, 0)
+#define __BITS_65  (0, 0, 1, 0, 0, 0, 0, 0, 1)
+#define __BITS_66  (0, 0, 1, 0, 0, 0, 0, 1, 0)
+#define __BITS_67  (0, 0, 1, 0, 0, 0, 0, 1, 1)
+#define __BITS_68  (0, 0, 1, 0, 0, 0, 1, 0, 0)
+#define __BITS_69  (0, 0, 1, 0, 0, 0, 1, 0, 1)
+#define __BITS_70  (0, 0, 1, 0, 0, 0, 1, 1, 0)
+#define __BITS_71  (0, 0, 1, 0, 0, 0, 1, 1, 1)
+#define __BITS_72  (0, 0, 1, 0, 0, 1, 0, 0, 0)
+#define __BITS_73  (0, 0, 1, 0, 0, 1, 0, 0, 1)
+#define __BITS_74  (0, 0, 1, 0, 0, 1, 0, 1, 0)
+#define __BITS_75  (0, 0, 1, 0, 0, 1, 0, 1, 1)
+#define __BITS_76  (0, 0, 1, 0, 0, 1, 1, 0, 0)
+#define __BITS_77  (0, 0, 1, 0, 0, 1, 1, 0, 1)
+#define __BITS_78  (0, 0, 1, 0, 0, 1, 1, 1, 0)
+#define __BITS_79  (0, 0, 1, 0, 0, 1, 1, 1, 1)
+#define __BITS_80  (0, 0, 1, 0, 1, 0, 0, 0, 0)
+#define __BITS_81  (0, 0, 1, 0, 1, 0, 0, 0, 1)
+#define __BITS_82  (0, 0, 1, 0, 1, 0, 0, 1, 0)
+#define __BITS_83  (0, 0, 1, 0, 1, 0, 0, 1, 1)
+#define __BITS_84  (0, 0, 1, 0, 1, 0, 1, 0, 0)
+#define __BITS_85  (0, 0, 1, 0, 1, 0, 1, 0, 1)
+#define __BITS_86  (0, 0, 1, 0, 1, 0, 1, 1, 0)
+#define __BITS_87  (0, 0, 1, 0, 1, 0, 1, 1, 1)
+#define __BITS_88  (0, 0, 1, 0, 1, 1, 0, 0, 0)
+#define __BITS_89  (0, 0, 1, 0, 1, 1, 0, 0, 1)
+#define __BITS_90  (0, 0, 1, 0, 1, 1, 0, 1, 0)
+#define __BITS_91  (0, 0, 1, 0, 1, 1, 0, 1, 1)
+#define __BITS_92  (0, 0, 1, 0, 1, 1, 1, 0, 0)
+#define __BITS_93  (0, 0, 1, 0, 1, 1, 1, 0, 1)
+#define __BITS_94  (0, 0, 1, 0, 1, 1, 1, 1, 0)
+#define __BITS_95  (0, 0, 1, 0, 1, 1, 1, 1, 1)
+#define __BITS_96  (0, 0, 1, 1, 0, 0, 0, 0, 0)
+#define __BITS_97  (0, 0, 1, 1, 0, 0, 0, 0, 1)
+#define __BITS_98  (0, 0, 1, 1, 0, 0, 0, 1, 0)
+#define __BITS_99  (0, 0, 1, 1, 0, 0, 0, 1, 1)
+#define __BITS_100 (0, 0, 1, 1, 0, 0, 1, 0, 0)
+#define __BITS_101 (0, 0, 1, 1, 0, 0, 1, 0, 1)
+#define __BITS_102 (0, 0, 1, 1, 0, 0, 1, 1, 0)
+#define __BITS_103 (0, 0, 1, 1, 0, 0, 1, 1, 1)
+#define __BITS_104 (0, 0, 1, 1, 0, 1, 0, 0, 0)
+#define __BITS_105 (0, 0, 1, 1, 0, 1, 0, 0, 1)
+#define __BITS_106 (0, 0, 1, 1, 0, 1, 0, 1, 0)
+#define __BITS_107 (0, 0, 1, 1, 0, 1, 0, 1, 1)
+#define __BITS_108 (0, 0, 1, 1, 0, 1, 1, 0, 0)
+#define __BITS_109 (0, 0, 1, 1, 0, 1, 1, 0, 1)
+#define __BITS_110 (0, 0, 1, 1, 0, 1, 1, 1, 0)
+#define __BITS_111 (0, 0, 1, 1, 0, 1, 1, 1, 1)
+#define __BITS_112 (0, 0, 1, 1, 1, 0, 0, 0, 0)
+#define __BITS_113 (0, 0, 1, 1, 1, 0, 0, 0, 1)
+#define __BITS_114 (0, 0, 1, 1, 1, 0, 0, 1, 0)
+#define __BITS_115 (0, 0, 1, 1, 1, 0, 0, 1, 1)
+#define __BITS_116 (0, 0, 1, 1, 1, 0, 1, 0, 0)
+#define __BITS_117 (0, 0, 1, 1, 1, 0, 1, 0, 1)
+#define __BITS_118 (0, 0, 1, 1, 1, 0, 1, 1, 0)
+#define __BITS_119 (0, 0, 1, 1, 1, 0, 1, 1, 1)
+#define __BITS_120 (0, 0, 1, 1, 1, 1, 0, 0, 0)
+#define __BITS_121 (0, 0, 1, 1, 1, 1, 0, 0, 1)
+#define __BITS_122 (0, 0, 1, 1, 1, 1, 0, 1, 0)
+#define __BITS_123 (0, 0, 1, 1, 1, 1, 0, 1, 1)
+#define __BITS_124 (0, 0, 1, 1, 1, 1, 1, 0, 0)
+#define __BITS_125 (0, 0, 1, 1, 1, 1, 1, 0, 1)
+#define __BITS_126 (0, 0, 1, 1, 1, 1, 1, 1, 0)
+#define __BITS_127 (0, 0, 1, 1, 1, 1, 1, 1, 1)
+#define __BITS_128 (0, 1, 0, 0, 0, 0, 0, 0, 0)
+#define __BITS_129 (0, 1, 0, 0, 0, 0, 0, 0, 1)
+#define __BITS_130 (0, 1, 0, 0, 0, 0, 0, 1, 0)
+#define __BITS_131 (0, 1, 0, 0, 0, 0, 0, 1, 1)
+#define __BITS_132 (0, 1, 0, 0, 0, 0, 1, 0, 0)
+#define __BITS_133 (0, 1, 0, 0, 0, 0, 1, 0, 1)
+#define __BITS_134 (0, 1, 0, 0, 0, 0, 1, 1, 0)
+#define __BITS_135 (0, 1, 0, 0, 0, 0, 1, 1, 1)
+#define __BITS_136 (0, 1, 0, 0, 0, 1, 0, 0, 0)
+#define __BITS_137 (0, 1, 0, 0, 0, 1, 0, 0, 1)
+#define __BITS_138 (0, 1, 0, 0, 0, 1, 0, 1, 0)
+#define __BITS_139 (0, 1, 0, 0, 0, 1, 0, 1, 1)
+#define __BITS_140 (0, 1, 0, 0, 0, 1, 1, 0, 0)
+#define __BITS_141 (0, 1, 0, 0, 0, 1, 1, 0, 1)
+#define __BITS_142 (0, 1, 0, 0, 0, 1, 1, 1, 0)
+#define __BITS_143 (0, 1, 0, 0, 0, 1, 1, 1, 1)
+#define __BITS_144 (0, 1, 0, 0, 1, 0, 0, 0, 0)
+#define __BITS_145 (0, 1, 0, 0, 1, 0, 0, 0, 1)
+#define __BITS_146 (0, 1, 0, 0, 1, 0, 0, 1, 0)
+#define __BITS_147 (0, 1, 0, 0, 1, 0, 0, 1, 1)
+#define __BITS_148 (0, 1, 0, 0, 1, 0, 1, 0, 0)
+#define __BITS_149 (0, 1, 0, 0, 1, 0, 1, 0, 1)
+#define __BITS_150 (0, 1, 0, 0, 1, 0, 1, 1, 0)
+#define __BITS_151 (0, 1, 0, 0, 1, 0, 1, 1, 1)
+#define __BITS_152 (0, 1, 0, 0, 1, 1, 0, 0, 0)
+#define __BITS_153 (0, 1, 0, 0, 1, 1, 0, 0, 1)
+#define __BITS_154 (0, 1, 0, 0, 1, 1, 0, 1, 0)
+#define __BITS_155 (0, 1, 0, 0, 1, 1, 0, 1, 1)
+#define __BITS_156 (0, 1, 0, 0, 1, 1, 1, 0, 0)
+#define __BITS_157 (0, 1, 0, 0, 1, 1, 1, 0, 1)
+#define __BITS_158 (0, 1, 0, 0, 1, 1, 1, 1, 0)
+#define __BITS_159 (0, 1, 0, 0, 1, 1, 1, 1, 1)
+#define __BITS_160 (0, 1, 0, 1, 0, 0, 0, 0, 0)
+#define __BITS_161 (0, 1, 0, 1, 0, 0, 0, 0, 1)
+#define __BITS_162 (0, 1, 0, 1, 0, 0, 0, 1, 0)
+#define __BITS_163 (0, 1, 0, 1, 0, 0, 0, 1, 1)
+#define __BITS_164 (0, 1, 0, 1, 0, 0, 1, 0, 0)
+#define __BITS_165 (0, 1, 0, 1, 0, 0, 1, 0, 1)
+#define __BITS_166 (0, 1, 0, 1, 0, 0, 1, 1, 0)
+#define __BITS_167 (0, 1, 0, 1, 0, 0, 1, 1, 1)
+#define __BITS_168 (0, 1, 0, 1, 0, 1, 0, 0, 0)
+#define __BITS_169 (0, 1, 0, 1, 0, 1, 0, 0, 1)
+#define __BITS_170 (0, 1, 0, 1, 0, 1, 0, 1, 0)
+#define __BITS_171 (0, 1, 0, 1, 0, 1, 0, 1, 1)
+#define __BITS_172 (0, 1, 0, 1, 0, 1, 1, 0, 0)
+#define __BITS_173 (0, 1, 0, 1, 0, 1, 1, 0, 1)
+#define __BITS_174 (0, 1, 0, 1, 0, 1, 1, 1, 0)
+#define __BITS_175 (0, 1, 0, 1, 0, 1, 1, 1, 1)
+#define __BITS_176 (0, 1, 0, 1, 1, 0, 0, 0, 0)
+#define __BITS_177 (0, 1, 0, 1, 1, 0, 0, 0, 1)
+#define __BITS_178 (0, 1, 0, 1, 1, 0, 0, 1, 0)
+#define __BITS_179 (0, 1, 0, 1, 1, 0, 0, 1, 1)
+#define __BITS_180 (0, 1, 0, 1, 1, 0, 1, 0, 0)
+#define __BITS_181 (0, 1, 0, 1, 1, 0, 1, 0, 1)
+#define __BITS_182 (0, 1, 0, 1, 1, 0, 1, 1, 0)
+#define __BITS_183 (0, 1, 0, 1, 1, 0, 1, 1, 1)
+#define __BITS_184 (0, 1, 0, 1, 1, 1, 0, 0, 0)
+#define __BITS_185 (0, 1, 0, 1, 1, 1, 0, 0, 1)
+#define __BITS_186 (0, 1, 0, 1, 1, 1, 0, 1, 0)
+#define __BITS_187 (0, 1, 0, 1, 1, 1, 0, 1, 1)
+#define __BITS_188 (0, 1, 0, 1, 1, 1, 1, 0, 0)
+#define __BITS_189 (0, 1, 0, 1, 1, 1, 1, 0, 1)
+#define __BITS_190 (0, 1, 0, 1, 1, 1, 1, 1, 0)
+#define __BITS_191 (0, 1, 0, 1, 1, 1, 1, 1, 1)
+#define __BITS_192 (0, 1, 1, 0, 0, 0, 0, 0, 0)
+#define __BITS_193 (0, 1, 1, 0, 0, 0, 0, 0, 1)
+#define __BITS_194 (0, 1, 1, 0, 0, 0, 0, 1, 0)
+#define __BITS_195 (0, 1, 1, 0, 0, 0, 0, 1, 1)
+#define __BITS_196 (0, 1, 1, 0, 0, 0, 1, 0, 0)
+#define __BITS_197 (0, 1, 1, 0, 0, 0, 1, 0, 1)
+#define __BITS_198 (0, 1, 1, 0, 0, 0, 1, 1, 0)
+#define __BITS_199 (0, 1, 1, 0, 0, 0, 1, 1, 1)
+#define __BITS_200 (0, 1, 1, 0, 0, 1, 0, 0, 0)
+#define __BITS_201 (0, 1, 1, 0, 0, 1, 0, 0, 1)
+#define __BITS_202 (0, 1, 1, 0, 0, 1, 0, 1, 0)
+#define __BITS_203 (0, 1, 1, 0, 0, 1, 0, 1, 1)
+#define __BITS_204 (0, 1, 1, 0, 0, 1, 1, 0, 0)
+#define __BITS_205 (0, 1, 1, 0, 0, 1, 1, 0, 1)
+#define __BITS_206 (0, 1, 1, 0, 0, 1, 1, 1, 0)
+#define __BITS_207 (0, 1, 1, 0, 0, 1, 1, 1, 1)
+#define __BITS_208 (0, 1, 1, 0, 1, 0, 0, 0, 0)
+#define __BITS_209 (0, 1, 1, 0, 1, 0, 0, 0, 1)
+#define __BITS_210 (0, 1, 1, 0, 1, 0, 0, 1, 0)
+#define __BITS_211 (0, 1, 1, 0, 1, 0, 0, 1, 1)
+#define __BITS_212 (0, 1, 1, 0, 1, 0, 1, 0, 0)
+#define __BITS_213 (0, 1, 1, 0, 1, 0, 1, 0, 1)
+#define __BITS_214 (0, 1, 1, 0, 1, 0, 1, 1, 0)
+#define __BITS_215 (0, 1, 1, 0, 1, 0, 1, 1, 1)
+#define __BITS_216 (0, 1, 1, 0, 1, 1, 0, 0, 0)
+#define __BITS_217 (0, 1, 1, 0, 1, 1, 0, 0, 1)
+#define __BITS_218 (0, 1, 1, 0, 1, 1, 0, 1, 0)
+#define __BITS_219 (0, 1, 1, 0, 1, 1, 0, 1, 1)
+#define __BITS_220 (0, 1, 1, 0, 1, 1, 1, 0, 0)
+#define __BITS_221 (0, 1, 1, 0, 1, 1, 1, 0, 1)
+#define __BITS_222 (0, 1, 1, 0, 1, 1, 1, 1, 0)
+#define __BITS_223 (0, 1, 1, 0, 1, 1, 1, 1, 1)
+#define __BITS_224 (0, 1, 1, 1, 0, 0, 0, 0, 0)
+#define __BITS_225 (0, 1, 1, 1, 0, 0, 0, 0, 1)
+#define __BITS_226 (0, 1, 1, 1, 0, 0, 0, 1, 0)
+#define __BITS_227 (0, 1, 1, 1, 0, 0, 0, 1, 1)
+#define __BITS_228 (0, 1, 1, 1, 0, 0, 1, 0, 0)
+#define __BITS_229 (0, 1, 1, 1, 0, 0, 1, 0, 1)
+#define __BITS_230 (0, 1, 1, 1, 0, 0, 1, 1, 0)
+#define __BITS_231 (0, 1, 1, 1, 0, 0, 1, 1, 1)
+#define __BITS_232 (0, 1, 1, 1, 0, 1, 0, 0, 0)
+#define __BITS_233 (0, 1, 1, 1, 0, 1, 0, 0, 1)
+#define __BITS_234 (0, 1, 1, 1, 0, 1, 0, 1, 0)
+#define __BITS_235 (0, 1, 1, 1, 0, 1, 0, 1, 1)
+#define __BITS_236 (0, 1, 1, 1, 0, 1, 1, 0, 0)
+#define __BITS_237 (0, 1, 1, 1, 0, 1, 1, 0, 1)
+#define __BITS_238 (0, 1, 1, 1, 0, 1, 1, 1, 0)
+#define __BITS_239 (0, 1, 1, 1, 0, 1, 1, 1, 1)
+#define __BITS_240 (0, 1, 1, 1, 1, 0, 0, 0, 0)
+#define __BITS_241 (0, 1, 1, 1, 1, 0, 0, 0, 1)
+#define __BITS_242 (0, 1, 1, 1, 1, 0, 0, 1, 0)
+#define __BITS_243 (0, 1, 1, 1, 1, 0, 0, 1, 1)
+#define __BITS_244 (0, 1, 1, 1, 1, 0, 1, 0, 0)
+#define __BITS_245 (0, 1, 1, 1, 1, 0, 1, 0, 1)
+#define __BITS_246 (0, 1, 1, 1, 1, 0, 1, 1, 0)
+#define __BITS_247 (0, 1, 1, 1, 1, 0, 1, 1, 1)
+#define __BITS_248 (0, 1, 1, 1, 1, 1, 0, 0, 0)
+#define __BITS_249 (0, 1, 1, 1, 1, 1, 0, 0, 1)
+#define __BITS_250 (0, 1, 1, 1, 1, 1, 0, 1, 0)
+#define __BITS_251 (0, 1, 1, 1, 1, 1, 0, 1, 1)
+#define __BITS_252 (0, 1, 1, 1, 1, 1, 1, 0, 0)
+#define __BITS_253 (0, 1, 1, 1, 1, 1, 1, 0, 1)
+#define __BITS_254 (0, 1, 1, 1, 1, 1, 1, 1, 0)
+#define __BITS_255 (0, 1, 1, 1, 1, 1, 1, 1, 1)
+#define __BITS_256 (1, 0, 0, 0, 0, 0, 0, 0, 0)
+#define __BITS_257 (1, 0, 0, 0, 0, 0, 0, 0, 1)
+#define __BITS_258 (1, 0, 0, 0, 0, 0, 0, 1, 0)
+#define __BITS_259 (1, 0, 0, 0, 0, 0, 0, 1, 1)
+#define __BITS_260 (1, 0, 0, 0, 0, 0, 1, 0, 0)
+#define __BITS_261 (1, 0, 0, 0, 0, 0, 1, 0, 1)
+#define __BITS_262 (1, 0, 0, 0, 0, 0, 1, 1, 0)
+#define __BITS_263 (1, 0, 0, 0, 0, 0, 1, 1, 1)
+#define __BITS_264 (1, 0, 0, 0, 0, 1, 0, 0, 0)
+#define __BITS_265 (1, 0, 0, 0, 0, 1, 0, 0, 1)
+#define __BITS_266 (1, 0, 0, 0, 0, 1, 0, 1, 0)
+#define __BITS_267 (1, 0, 0, 0, 0, 1, 0, 1, 1)
+#define __BITS_268 (1, 0, 0, 0, 0, 1, 1, 0, 0)
+#define __BITS_269 (1, 0, 0, 0, 0, 1, 1, 0, 1)
+#define __BITS_270 (1, 0, 0, 0, 0, 1, 1, 1, 0)
+#define __BITS_271 (1, 0, 0, 0, 0, 1, 1, 1, 1)
+#define __BITS_272 (1, 0, 0, 0, 1, 0, 0, 0, 0)
+#define __BITS_273 (1, 0, 0, 0, 1, 0, 0, 0, 1)
+#define __BITS_274 (1, 0, 0, 0, 1, 0, 0, 1, 0)
+#define __BITS_275 (1, 0, 0, 0, 1, 0, 0, 1, 1)
+#define __BITS_276 (1, 0, 0, 0, 1, 0, 1, 0, 0)
+#define __BITS_277 (1, 0, 0, 0, 1, 0, 1, 0, 1)
+#define __BITS_278 (1, 0, 0, 0, 1, 0, 1, 1, 0)
+#define __BITS_279 (1, 0, 0, 0, 1, 0, 1, 1, 1)
+#define __BITS_280 (1, 0, 0, 0, 1, 1, 0, 0, 0)
+#define __BITS_281 (1, 0, 0, 0, 1, 1, 0, 0, 1)
+#define __BITS_282 (1, 0, 0, 0, 1, 1, 0, 1, 0)
+#define __BITS_283 (1, 0, 0, 0, 1, 1, 0, 1, 1)
+#define __BITS_284 (1, 0, 0, 0, 1, 1, 1, 0, 0)
+#define __BITS_285 (1, 0, 0, 0, 1, 1, 1, 0, 1)
+#define __BITS_286 (1, 0, 0, 0, 1, 1, 1, 1, 0)
+#define __BITS_287 (1, 0, 0, 0, 1, 1, 1, 1, 1)
+#define __BITS_288 (1, 0, 0, 1, 0, 0, 0, 0, 0)
+#define __BITS_289 (1, 0, 0, 1, 0, 0, 0, 0, 1)
+#define __BITS_290 (1, 0, 0, 1, 0, 0, 0, 1, 0)
+#define __BITS_291 (1, 0, 0, 1, 0, 0, 0, 1, 1)
+#define __BITS_292 (1, 0, 0, 1, 0, 0, 1, 0, 0)
+#define __BITS_293 (1, 0, 0, 1, 0, 0, 1, 0, 1)
+#define __BITS_294 (1, 0, 0, 1, 0, 0, 1, 1, 0)
+#define __BITS_295 (1, 0, 0, 1, 0, 0, 1, 1, 1)
+#define __BITS_296 (1, 0, 0, 1, 0, 1, 0, 0, 0)
+#define __BITS_297 (1, 0, 0, 1, 0, 1, 0, 0, 1)
+#define __BITS_298 (1, 0, 0, 1, 0, 1, 0, 1, 0)
+#define __BITS_299 (1, 0, 0, 1, 0, 1, 0, 1, 1)
+#define __BITS_300 (1, 0, 0, 1, 0, 1, 1, 0, 0)
+#define __BITS_301 (1, 0, 0, 1, 0, 1, 1, 0, 1)
+#define __BITS_302 (1, 0, 0, 1, 0, 1, 1, 1, 0)
+#define __BITS_303 (1, 0, 0, 1, 0, 1, 1, 1, 1)
+#define __BITS_304 (1, 0, 0, 1, 1, 0, 0, 0, 0)
+#define __BITS_305 (1, 0, 0, 1, 1, 0, 0, 0, 1)
+#define __BITS_306 (1, 0, 0, 1, 1, 0, 0, 1, 0)
+#define __BITS_307 (1, 0, 0, 1, 1, 0, 0, 1, 1)
+#define __BITS_308 (1, 0, 0, 1, 1, 0, 1, 0, 0)
+#define __BITS_309 (1, 0, 0, 1, 1, 0, 1, 0, 1)
+#define __BITS_310 (1, 0, 0, 1, 1, 0, 1, 1, 0)
+#define __BITS_311 (1, 0, 0, 1, 1, 0, 1, 1, 1)
+#define __BITS_312 (1, 0, 0, 1, 1, 1, 0, 0, 0)
+#define __BITS_313 (1, 0, 0, 1, 1, 1, 0, 0, 1)
+#define __BITS_314 (1, 0, 0, 1, 1, 1, 0, 1, 0)
+#define __BITS_315 (1, 0, 0, 1, 1, 1, 0, 1, 1)
+#define __BITS_316 (1, 0, 0, 1, 1, 1, 1, 0, 0)
+#define __BITS_317 (1, 0, 0, 1, 1, 1, 1, 0, 1)
+#define __BITS_318 (1, 0, 0, 1, 1, 1, 1, 1, 0)
+#define __BITS_319 (1, 0, 0, 1, 1, 1, 1, 1, 1)
+#define __BITS_320 (1, 0, 1, 0, 0, 0, 0, 0, 0)
+#define __BITS_321 (1, 0, 1, 0, 0, 0, 0, 0, 1)
+#define __BITS_322 (1, 0, 1, 0, 0, 0, 0, 1, 0)
+#define __BITS_323 (1, 0, 1, 0, 0, 0, 0, 1, 1)
+#define __BITS_324 (1, 0, 1, 0, 0, 0, 1, 0, 0)
+#define __BITS_325 (1, 0, 1, 0, 0, 0, 1, 0, 1)
+#define __BITS_326 (1, 0, 1, 0, 0, 0, 1, 1, 0)
+#define __BITS_327 (1, 0, 1, 0, 0, 0, 1, 1, 1)
+#define __BITS_328 (1, 0, 1, 0, 0, 1, 0, 0, 0)
+#define __BITS_329 (1, 0, 1, 0, 0, 1, 0, 0, 1)
+#define __BITS_330 (1, 0, 1, 0, 0, 1, 0, 1, 0)
+#define __BITS_331 (1, 0, 1, 0, 0, 1, 0, 1, 1)
+#define __BITS_332 (1, 0, 1, 0, 0, 1, 1, 0, 0)
+#define __BITS_333 (1, 0, 1, 0, 0, 1, 1, 0, 1)
+#define __BITS_334 (1, 0, 1, 0, 0, 1, 1, 1, 0)
+#define __BITS_335 (1, 0, 1, 0, 0, 1, 1, 1, 1)
+#define __BITS_336 (1, 0, 1, 0, 1, 0, 0, 0, 0)
+#define __BITS_337 (1, 0, 1, 0, 1, 0, 0, 0, 1)
+#define __BITS_338 (1, 0, 1, 0, 1, 0, 0, 1, 0)
+#define __BITS_339 (1, 0, 1, 0, 1, 0, 0, 1, 1)
+#define __BITS_340 (1, 0, 1, 0, 1, 0, 1, 0, 0)
+#define __BITS_341 (1, 0, 1, 0, 1, 0, 1, 0, 1)
+#define __BITS_342 (1, 0, 1, 0, 1, 0, 1, 1, 0)
+#define __BITS_343 (1, 0, 1, 0, 1, 0, 1, 1, 1)
+#define __BITS_344 (1, 0, 1, 0, 1, 1, 0, 0, 0)
+#define __BITS_345 (1, 0, 1, 0, 1, 1, 0, 0, 1)
+#define __BITS_346 (1, 0, 1, 0, 1, 1, 0, 1, 0)
+#define __BITS_347 (1, 0, 1, 0, 1, 1, 0, 1, 1)
+#define __BITS_348 (1, 0, 1, 0, 1, 1, 1, 0, 0)
+#define __BITS_349 (1, 0, 1, 0, 1, 1, 1, 0, 1)
+#define __BITS_350 (1, 0, 1, 0, 1, 1, 1, 1, 0)
+#define __BITS_351 (1, 0, 1, 0, 1, 1, 1, 1, 1)
+#define __BITS_352 (1, 0, 1, 1, 0, 0, 0, 0, 0)
+#define __BITS_353 (1, 0, 1, 1, 0, 0, 0, 0, 1)
+#define __BITS_354 (1, 0, 1, 1, 0, 0, 0, 1, 0)
+#define __BITS_355 (1, 0, 1, 1, 0, 0, 0, 1, 1)
+#define __BITS_356 (1, 0, 1, 1, 0, 0, 1, 0, 0)
+#define __BITS_357 (1, 0, 1, 1, 0, 0, 1, 0, 1)
+#define __BITS_358 (1, 0, 1, 1, 0, 0, 1, 1, 0)
+#define __BITS_359 (1, 0, 1, 1, 0, 0, 1, 1, 1)
+#define __BITS_360 (1, 0, 1, 1, 0, 1, 0, 0, 0)
+#define __BITS_361 (1, 0, 1, 1, 0, 1, 0, 0, 1)
+#define __BITS_362 (1, 0, 1, 1, 0, 1, 0, 1, 0)
+#define __BITS_363 (1, 0, 1, 1, 0, 1, 0, 1, 1)
+#define __BITS_364 (1, 0, 1, 1, 0, 1, 1, 0, 0)
+#define __BITS_365 (1, 0, 1, 1, 0, 1, 1, 0, 1)
+#define __BITS_366 (1, 0, 1, 1, 0, 1, 1, 1, 0)
+#define __BITS_367 (1, 0, 1, 1, 0, 1, 1, 1, 1)
+#define __BITS_368 (1, 0, 1, 1, 1, 0, 0, 0, 0)
+#define __BITS_369 (1, 0, 1, 1, 1, 0, 0, 0, 1)
+#define __BITS_370 (1, 0, 1, 1, 1, 0, 0, 1, 0)
+#define __BITS_371 (1, 0, 1, 1, 1, 0, 0, 1, 1)
+#define __BITS_372 (1, 0, 1, 1, 1, 0, 1, 0, 0)
+#define __BITS_373 (1, 0, 1, 1, 1, 0, 1, 0, 1)
+#define __BITS_374 (1, 0, 1, 1, 1, 0, 1, 1, 0)
+#define __BITS_375 (1, 0, 1, 1, 1, 0, 1, 1, 1)
+#define __BITS_376 (1, 0, 1, 1, 1, 1, 0, 0, 0)
+#define __BITS_377 (1, 0, 1, 1, 1, 1, 0, 0, 1)
+#define __BITS_378 (1, 0, 1, 1, 1, 1, 0, 1, 0)
+#define __BITS_379 (1, 0, 1, 1, 1, 1, 0, 1, 1)
+#define __BITS_380 (1, 0, 1, 1, 1, 1, 1, 0, 0)
+#define __BITS_381 (1, 0, 1, 1, 1, 1, 1, 0, 1)
+#define __BITS_382 (1, 0, 1, 1, 1, 1, 1, 1, 0)
+#define __BITS_383 (1, 0, 1, 1, 1, 1, 1, 1, 1)
+#define __BITS_384 (1, 1, 0, 0, 0, 0, 0, 0, 0)
+#define __BITS_385 (1, 1, 0, 0, 0, 0, 0, 0, 1)
+#define __BITS_386 (1, 1, 0, 0, 0, 0, 0, 1, 0)
+#define __BITS_387 (1, 1, 0, 0, 0, 0, 0, 1, 1)
+#define __BITS_388 (1, 1, 0, 0, 0, 0, 1, 0, 0)
+#define __BITS_389 (1, 1, 0, 0, 0, 0, 1, 0, 1)
+#define __BITS_390 (1, 1, 0, 0, 0, 0, 1, 1, 0)
+#define __BITS_391 (1, 1, 0, 0, 0, 0, 1, 1, 1)
+#define __BITS_392 (1, 1, 0, 0, 0, 1, 0, 0, 0)
+#define __BITS_393 (1, 1, 0, 0, 0, 1, 0, 0, 1)
+#define __BITS_394 (1, 1, 0, 0, 0, 1, 0, 1, 0)
+#define __BITS_395 (1, 1, 0, 0, 0, 1, 0, 1, 1)
+#define __BITS_396 (1, 1, 0, 0, 0, 1, 1, 0, 0)
+#define __BITS_397 (1, 1, 0, 0, 0, 1, 1, 0, 1)
+#define __BITS_398 (1, 1, 0, 0, 0, 1, 1, 1, 0)
+#define __BITS_399 (1, 1, 0, 0, 0, 1, 1, 1, 1)
+#define __BITS_400 (1, 1, 0, 0, 1, 0, 0, 0, 0)
+#define __BITS_401 (1, 1, 0, 0, 1, 0, 0, 0, 1)
+#define __BITS_402 (1, 1, 0, 0, 1, 0, 0, 1, 0)
+#define __BITS_403 (1, 1, 0, 0, 1, 0, 0, 1, 1)
+#define __BITS_404 (1, 1, 0, 0, 1, 0, 1, 0, 0)
+#define __BITS_405 (1, 1, 0, 0, 1, 0, 1, 0, 1)
+#define __BITS_406 (1, 1, 0, 0, 1, 0, 1, 1, 0)
+#define __BITS_407 (1, 1, 0, 0, 1, 0, 1, 1, 1)
+#define __BITS_408 (1, 1, 0, 0, 1, 1, 0, 0, 0)
+#define __BITS_409 (1, 1, 0, 0, 1, 1, 0, 0, 1)
+#define __BITS_410 (1, 1, 0, 0, 1, 1, 0, 1, 0)
+#define __BITS_411 (1, 1, 0, 0, 1, 1, 0, 1, 1)
+#define __BITS_412 (1, 1, 0, 0, 1, 1, 1, 0, 0)
+#define __BITS_413 (1, 1, 0, 0, 1, 1, 1, 0, 1)
+#define __BITS_414 (1, 1, 0, 0, 1, 1, 1, 1, 0)
+#define __BITS_415 (1, 1, 0, 0, 1, 1, 1, 1, 1)
+#define __BITS_416 (1, 1, 0, 1, 0, 0, 0, 0, 0)
+#define __BITS_417 (1, 1, 0, 1, 0, 0, 0, 0, 1)
+#define __BITS_418 (1, 1, 0, 1, 0, 0, 0, 1, 0)
+#define __BITS_419 (1, 1, 0, 1, 0, 0, 0, 1, 1)
+#define __BITS_420 (1, 1, 0, 1, 0, 0, 1, 0, 0)
+#define __BITS_421 (1, 1, 0, 1, 0, 0, 1, 0, 1)
+#define __BITS_422 (1, 1, 0, 1, 0, 0, 1, 1, 0)
+#define __BITS_423 (1, 1, 0, 1, 0, 0, 1, 1, 1)
+#define __BITS_424 (1, 1, 0, 1, 0, 1, 0, 0, 0)
+#define __BITS_425 (1, 1, 0, 1, 0, 1, 0, 0, 1)
+#define __BITS_426 (1, 1, 0, 1, 0, 1, 0, 1, 0)
+#define __BITS_427 (1, 1, 0, 1, 0, 1, 0, 1, 1)
+#define __BITS_428 (1, 1, 0, 1, 0, 1, 1, 0, 0)
+#define __BITS_429 (1, 1, 0, 1, 0, 1, 1, 0, 1)
+#define __BITS_430 (1, 1, 0, 1, 0, 1, 1, 1, 0)
+#define __BITS_431 (1, 1, 0, 1, 0, 1, 1, 1, 1)
+#define __BITS_432 (1, 1, 0, 1, 1, 0, 0, 0, 0)
+#define __BITS_433 (1, 1, 0, 1, 1, 0, 0, 0, 1)
+#define __BITS_434 (1, 1, 0, 1, 1, 0, 0, 1, 0)
+#define __BITS_435 (1, 1, 0, 1, 1, 0, 0, 1, 1)
+#define __BITS_436 (1, 1, 0, 1, 1, 0, 1, 0, 0)
+#define __BITS_437 (1, 1, 0, 1, 1, 0, 1, 0, 1)
+#define __BITS_438 (1, 1, 0, 1, 1, 0, 1, 1, 0)
+#define __BITS_439 (1, 1, 0, 1, 1, 0, 1, 1, 1)
+#define __BITS_440 (1, 1, 0, 1, 1, 1, 0, 0, 0)
+#define __BITS_441 (1, 1, 0, 1, 1, 1, 0, 0, 1)
+#define __BITS_442 (1, 1, 0, 1, 1, 1, 0, 1, 0)
+#define __BITS_443 (1, 1, 0, 1, 1, 1, 0, 1, 1)
+#define __BITS_444 (1, 1, 0, 1, 1, 1, 1, 0, 0)
+#define __BITS_445 (1, 1, 0, 1, 1, 1, 1, 0, 1)
+#define __BITS_446 (1, 1, 0, 1, 1, 1, 1, 1, 0)
+#define __BITS_447 (1, 1, 0, 1, 1, 1, 1, 1, 1)
+#define __BITS_448 (1, 1, 1, 0, 0, 0, 0, 0, 0)
+#define __BITS_449 (1, 1, 1, 0, 0, 0, 0, 0, 1)
+#define __BITS_450 (1, 1, 1, 0, 0, 0, 0, 1, 0)
+#define __BITS_451 (1, 1, 1, 0, 0, 0, 0, 1, 1)
+#define __BITS_452 (1, 1, 1, 0, 0, 0, 1, 0, 0)
+#define __BITS_453 (1, 1, 1, 0, 0, 0, 1, 0, 1)
+#define __BITS_454 (1, 1, 1, 0, 0, 0, 1, 1, 0)
+#define __BITS_455 (1, 1, 1, 0, 0, 0, 1, 1, 1)
+#define __BITS_456 (1, 1, 1, 0, 0, 1, 0, 0, 0)
+#define __BITS_457 (1, 1, 1, 0, 0, 1, 0, 0, 1)
+#define __BITS_458 (1, 1, 1, 0, 0, 1, 0, 1, 0)
+#define __BITS_459 (1, 1, 1, 0, 0, 1, 0, 1, 1)
+#define __BITS_460 (1, 1, 1, 0, 0, 1, 1, 0, 0)
+#define __BITS_461 (1, 1, 1, 0, 0, 1, 1, 0, 1)
+#define __BITS_462 (1, 1, 1, 0, 0, 1, 1, 1, 0)
+#define __BITS_463 (1, 1, 1, 0, 0, 1, 1, 1, 1)
+#define __BITS_464 (1, 1, 1, 0, 1, 0, 0, 0, 0)
+#define __BITS_465 (1, 1, 1, 0, 1, 0, 0, 0, 1)
+#define __BITS_466 (1, 1, 1, 0, 1, 0, 0, 1, 0)
+#define __BITS_467 (1, 1, 1, 0, 1, 0, 0, 1, 1)
+#define __BITS_468 (1, 1, 1, 0, 1, 0, 1, 0, 0)
+#define __BITS_469 (1, 1, 1, 0, 1, 0, 1, 0, 1)
+#define __BITS_470 (1, 1, 1, 0, 1, 0, 1, 1, 0)
+#define __BITS_471 (1, 1, 1, 0, 1, 0, 1, 1, 1)
+#define __BITS_472 (1, 1, 1, 0, 1, 1, 0, 0, 0)
+#define __BITS_473 (1, 1, 1, 0, 1, 1, 0, 0, 1)
+#define __BITS_474 (1, 1, 1, 0, 1, 1, 0, 1, 0)
+#define __BITS_475 (1, 1, 1, 0, 1, 1, 0, 1, 1)
+#define __BITS_476 (1, 1, 1, 0, 1, 1, 1, 0, 0)
+#define __BITS_477 (1, 1, 1, 0, 1, 1, 1, 0, 1)
+#define __BITS_478 (1, 1, 1, 0, 1, 1, 1, 1, 0)
+#define __BITS_479 (1, 1, 1, 0, 1, 1, 1, 1, 1)
+#define __BITS_480 (1, 1, 1, 1, 0, 0, 0, 0, 0)
+#define __BITS_481 (1, 1, 1, 1, 0, 0, 0, 0, 1)
+#define __BITS_482 (1, 1, 1, 1, 0, 0, 0, 1, 0)
+#define __BITS_483 (1, 1, 1, 1, 0, 0, 0, 1, 1)
+#define __BITS_484 (1, 1, 1, 1, 0, 0, 1, 0, 0)
+#define __BITS_485 (1, 1, 1, 1, 0, 0, 1, 0, 1)
+#define __BITS_486 (1, 1, 1, 1, 0, 0, 1, 1, 0)
+#define __BITS_487 (1, 1, 1, 1, 0, 0, 1, 1, 1)
+#define __BITS_488 (1, 1, 1, 1, 0, 1, 0, 0, 0)
+#define __BITS_489 (1, 1, 1, 1, 0, 1, 0, 0, 1)
+#define __BITS_490 (1, 1, 1, 1, 0, 1, 0, 1, 0)
+#define __BITS_491 (1, 1, 1, 1, 0, 1, 0, 1, 1)
+#define __BITS_492 (1, 1, 1, 1, 0, 1, 1, 0, 0)
+#define __BITS_493 (1, 1, 1, 1, 0, 1, 1, 0, 1)
+#define __BITS_494 (1, 1, 1, 1, 0, 1, 1, 1, 0)
+#define __BITS_495 (1, 1, 1, 1, 0, 1, 1, 1, 1)
+#define __BITS_496 (1, 1, 1, 1, 1, 0, 0, 0, 0)
+#define __BITS_497 (1, 1, 1, 1, 1, 0, 0, 0, 1)
+#define __BITS_498 (1, 1, 1, 1, 1, 0, 0, 1, 0)
+#define __BITS_499 (1, 1, 1, 1, 1, 0, 0, 1, 1)
+#define __BITS_500 (1, 1, 1, 1, 1, 0, 1, 0, 0)
+#define __BITS_501 (1, 1, 1, 1, 1, 0, 1, 0, 1)
+#define __BITS_502 (1, 1, 1, 1, 1, 0, 1, 1, 0)
+#define __BITS_503 (1, 1, 1, 1, 1, 0, 1, 1, 1)
+#define __BITS_504 (1, 1, 1, 1, 1, 1, 0, 0, 0)
+#define __BITS_505 (1, 1, 1, 1, 1, 1, 0, 0, 1)
+#define __BITS_506 (1, 1, 1, 1, 1, 1, 0, 1, 0)
+#define __BITS_507 (1, 1, 1, 1, 1, 1, 0, 1, 1)
+#define __BITS_508 (1, 1, 1, 1, 1, 1, 1, 0, 0)
+#define __BITS_509 (1, 1, 1, 1, 1, 1, 1, 0, 1)
+#define __BITS_510 (1, 1, 1, 1, 1, 1, 1, 1, 0)
+#define __BITS_511 (1, 1, 1, 1, 1, 1, 1, 1, 1)
+
+/* number of binary digits */
+#define __BITS_NUM_000000000 0
+#define __BITS_NUM_000000001 1
+#define __BITS_NUM_000000010 2
+#define __BITS_NUM_000000011 3
+#define __BITS_NUM_000000100 4
+#define __BITS_NUM_000000101 5
+#define __BITS_NUM_000000110 6
+#define __BITS_NUM_000000111 7
+#define __BITS_NUM_000001000 8
+#define __BITS_NUM_000001001 9
+#define __BITS_NUM_000001010 10
+#define __BITS_NUM_000001011 11
+#define __BITS_NUM_000001100 12
+#define __BITS_NUM_000001101 13
+#define __BITS_NUM_000001110 14
+#define __BITS_NUM_000001111 15
+#define __BITS_NUM_000010000 16
+#define __BITS_NUM_000010001 17
+#define __BITS_NUM_000010010 18
+#define __BITS_NUM_000010011 19
+#define __BITS_NUM_000010100 20
+#define __BITS_NUM_000010101 21
+#define __BITS_NUM_000010110 22
+#define __BITS_NUM_000010111 23
+#define __BITS_NUM_000011000 24
+#define __BITS_NUM_000011001 25
+#define __BITS_NUM_000011010 26
+#define __BITS_NUM_000011011 27
+#define __BITS_NUM_000011100 28
+#define __BITS_NUM_000011101 29
+#define __BITS_NUM_000011110 30
+#define __BITS_NUM_000011111 31
+#define __BITS_NUM_000100000 32
+#define __BITS_NUM_000100001 33
+#define __BITS_NUM_000100010 34
+#define __BITS_NUM_000100011 35
+#define __BITS_NUM_000100100 36
+#define __BITS_NUM_000100101 37
+#define __BITS_NUM_000100110 38
+#define __BITS_NUM_000100111 39
+#define __BITS_NUM_000101000 40
+#define __BITS_NUM_000101001 41
+#define __BITS_NUM_000101010 42
+#define __BITS_NUM_000101011 43
+#define __BITS_NUM_000101100 44
+#define __BITS_NUM_000101101 45
+#define __BITS_NUM_000101110 46
+#define __BITS_NUM_000101111 47
+#define __BITS_NUM_000110000 48
+#define __BITS_NUM_000110001 49
+#define __BITS_NUM_000110010 50
+#define __BITS_NUM_000110011 51
+#define __BITS_NUM_000110100 52
+#define __BITS_NUM_000110101 53
+#define __BITS_NUM_000110110 54
+#define __BITS_NUM_000110111 55
+#define __BITS_NUM_000111000 56
+#define __BITS_NUM_000111001 57
+#define __BITS_NUM_000111010 58
+#define __BITS_NUM_000111011 59
+#define __BITS_NUM_000111100 60
+#define __BITS_NUM_000111101 61
+#define __BITS_NUM_000111110 62
+#define __BITS_NUM_000111111 63
+#define __BITS_NUM_001000000 64
+#define __BITS_NUM_001000001 65
+#define __BITS_NUM_001000010 66
+#define __BITS_NUM_001000011 67
+#define __BITS_NUM_001000100 68
+#define __BITS_NUM_001000101 69
+#define __BITS_NUM_001000110 70
+#define __BITS_NUM_001000111 71
+#define __BITS_NUM_001001000 72
+#define __BITS_NUM_001001001 73
+#define __BITS_NUM_001001010 74
+#define __BITS_NUM_001001011 75
+#define __BITS_NUM_001001100 76
+#define __BITS_NUM_001001101 77
+#define __BITS_NUM_001001110 78
+#define __BITS_NUM_001001111 79
+#define __BITS_NUM_001010000 80
+#define __BITS_NUM_001010001 81
+#define __BITS_NUM_001010010 82
+#define __BITS_NUM_001010011 83
+#define __BITS_NUM_001010100 84
+#define __BITS_NUM_001010101 85
+#define __BITS_NUM_001010110 86
+#define __BITS_NUM_001010111 87
+#define __BITS_NUM_001011000 88
+#define __BITS_NUM_001011001 89
+#define __BITS_NUM_001011010 90
+#define __BITS_NUM_001011011 91
+#define __BITS_NUM_001011100 92
+#define __BITS_NUM_001011101 93
+#define __BITS_NUM_001011110 94
+#define __BITS_NUM_001011111 95
+#define __BITS_NUM_001100000 96
+#define __BITS_NUM_001100001 97
+#define __BITS_NUM_001100010 98
+#define __BITS_NUM_001100011 99
+#define __BITS_NUM_001100100 100
+#define __BITS_NUM_001100101 101
+#define __BITS_NUM_001100110 102
+#define __BITS_NUM_001100111 103
+#define __BITS_NUM_001101000 104
+#define __BITS_NUM_001101001 105
+#define __BITS_NUM_001101010 106
+#define __BITS_NUM_001101011 107
+#define __BITS_NUM_001101100 108
+#define __BITS_NUM_001101101 109
+#define __BITS_NUM_001101110 110
+#define __BITS_NUM_001101111 111
+#define __BITS_NUM_001110000 112
+#define __BITS_NUM_001110001 113
+#define __BITS_NUM_001110010 114
+#define __BITS_NUM_001110011 115
+#define __BITS_NUM_001110100 116
+#define __BITS_NUM_001110101 117
+#define __BITS_NUM_001110110 118
+#define __BITS_NUM_001110111 119
+#define __BITS_NUM_001111000 120
+#define __BITS_NUM_001111001 121
+#define __BITS_NUM_001111010 122
+#define __BITS_NUM_001111011 123
+#define __BITS_NUM_001111100 124
+#define __BITS_NUM_001111101 125
+#define __BITS_NUM_001111110 126
+#define __BITS_NUM_001111111 127
+#define __BITS_NUM_010000000 128
+#define __BITS_NUM_010000001 129
+#define __BITS_NUM_010000010 130
+#define __BITS_NUM_010000011 131
+#define __BITS_NUM_010000100 132
+#define __BITS_NUM_010000101 133
+#define __BITS_NUM_010000110 134
+#define __BITS_NUM_010000111 135
+#define __BITS_NUM_010001000 136
+#define __BITS_NUM_010001001 137
+#define __BITS_NUM_010001010 138
+#define __BITS_NUM_010001011 139
+#define __BITS_NUM_010001100 140
+#define __BITS_NUM_010001101 141
+#define __BITS_NUM_010001110 142
+#define __BITS_NUM_010001111 143
+#define __BITS_NUM_010010000 144
+#define __BITS_NUM_010010001 145
+#define __BITS_NUM_010010010 146
+#define __BITS_NUM_010010011 147
+#define __BITS_NUM_010010100 148
+#define __BITS_NUM_010010101 149
+#define __BITS_NUM_010010110 150
+#define __BITS_NUM_010010111 151
+#define __BITS_NUM_010011000 152
+#define __BITS_NUM_010011001 153
+#define __BITS_NUM_010011010 154
+#define __BITS_NUM_010011011 155
+#define __BITS_NUM_010011100 156
+#define __BITS_NUM_010011101 157
+#define __BITS_NUM_010011110 158
+#define __BITS_NUM_010011111 159
+#define __BITS_NUM_010100000 160
+#define __BITS_NUM_010100001 161
+#define __BITS_NUM_010100010 162
+#define __BITS_NUM_010100011 163
+#define __BITS_NUM_010100100 164
+#define __BITS_NUM_010100101 165
+#define __BITS_NUM_010100110 166
+#define __BITS_NUM_010100111 167
+#define __BITS_NUM_010101000 168
+#define __BITS_NUM_010101001 169
+#define __BITS_NUM_010101010 170
+#define __BITS_NUM_010101011 171
+#define __BITS_NUM_010101100 172
+#define __BITS_NUM_010101101 173
+#define __BITS_NUM_010101110 174
+#define __BITS_NUM_010101111 175
+#define __BITS_NUM_010110000 176
+#define __BITS_NUM_010110001 177
+#define __BITS_NUM_010110010 178
+#define __BITS_NUM_010110011 179
+#define __BITS_NUM_010110100 180
+#define __BITS_NUM_010110101 181
+#define __BITS_NUM_010110110 182
+#define __BITS_NUM_010110111 183
+#define __BITS_NUM_010111000 184
+#define __BITS_NUM_010111001 185
+#define __BITS_NUM_010111010 186
+#define __BITS_NUM_010111011 187
+#define __BITS_NUM_010111100 188
+#define __BITS_NUM_010111101 189
+#define __BITS_NUM_010111110 190
+#define __BITS_NUM_010111111 191
+#define __BITS_NUM_011000000 192
+#define __BITS_NUM_011000001 193
+#define __BITS_NUM_011000010 194
+#define __BITS_NUM_011000011 195
+#define __BITS_NUM_011000100 196
+#define __BITS_NUM_011000101 197
+#define __BITS_NUM_011000110 198
+#define __BITS_NUM_011000111 199
+#define __BITS_NUM_011001000 200
+#define __BITS_NUM_011001001 201
+#define __BITS_NUM_011001010 202
+#define __BITS_NUM_011001011 203
+#define __BITS_NUM_011001100 204
+#define __BITS_NUM_011001101 205
+#define __BITS_NUM_011001110 206
+#define __BITS_NUM_011001111 207
+#define __BITS_NUM_011010000 208
+#define __BITS_NUM_011010001 209
+#define __BITS_NUM_011010010 210
+#define __BITS_NUM_011010011 211
+#define __BITS_NUM_011010100 212
+#define __BITS_NUM_011010101 213
+#define __BITS_NUM_011010110 214
+#define __BITS_NUM_011010111 215
+#define __BITS_NUM_011011000 216
+#define __BITS_NUM_011011001 217
+#define __BITS_NUM_011011010 218
+#define __BITS_NUM_011011011 219
+#define __BITS_NUM_011011100 220
+#define __BITS_NUM_011011101 221
+#define __BITS_NUM_011011110 222
+#define __BITS_NUM_011011111 223
+#define __BITS_NUM_011100000 224
+#define __BITS_NUM_011100001 225
+#define __BITS_NUM_011100010 226
+#define __BITS_NUM_011100011 227
+#define __BITS_NUM_011100100 228
+#define __BITS_NUM_011100101 229
+#define __BITS_NUM_011100110 230
+#define __BITS_NUM_011100111 231
+#define __BITS_NUM_011101000 232
+#define __BITS_NUM_011101001 233
+#define __BITS_NUM_011101010 234
+#define __BITS_NUM_011101011 235
+#define __BITS_NUM_011101100 236
+#define __BITS_NUM_011101101 237
+#define __BITS_NUM_011101110 238
+#define __BITS_NUM_011101111 239
+#define __BITS_NUM_011110000 240
+#define __BITS_NUM_011110001 241
+#define __BITS_NUM_011110010 242
+#define __BITS_NUM_011110011 243
+#define __BITS_NUM_011110100 244
+#define __BITS_NUM_011110101 245
+#define __BITS_NUM_011110110 246
+#define __BITS_NUM_011110111 247
+#define __BITS_NUM_011111000 248
+#define __BITS_NUM_011111001 249
+#define __BITS_NUM_011111010 250
+#define __BITS_NUM_011111011 251
+#define __BITS_NUM_011111100 252
+#define __BITS_NUM_011111101 253
+#define __BITS_NUM_011111110 254
+#define __BITS_NUM_011111111 255
+#define __BITS_NUM_100000000 256
+#define __BITS_NUM_100000001 257
+#define __BITS_NUM_100000010 258
+#define __BITS_NUM_100000011 259
+#define __BITS_NUM_100000100 260
+#define __BITS_NUM_100000101 261
+#define __BITS_NUM_100000110 262
+#define __BITS_NUM_100000111 263
+#define __BITS_NUM_100001000 264
+#define __BITS_NUM_100001001 265
+#define __BITS_NUM_100001010 266
+#define __BITS_NUM_100001011 267
+#define __BITS_NUM_100001100 268
+#define __BITS_NUM_100001101 269
+#define __BITS_NUM_100001110 270
+#define __BITS_NUM_100001111 271
+#define __BITS_NUM_100010000 272
+#define __BITS_NUM_100010001 273
+#define __BITS_NUM_100010010 274
+#define __BITS_NUM_100010011 275
+#define __BITS_NUM_100010100 276
+#define __BITS_NUM_100010101 277
+#define __BITS_NUM_100010110 278
+#define __BITS_NUM_100010111 279
+#define __BITS_NUM_100011000 280
+#define __BITS_NUM_100011001 281
+#define __BITS_NUM_100011010 282
+#define __BITS_NUM_100011011 283
+#define __BITS_NUM_100011100 284
+#define __BITS_NUM_100011101 285
+#define __BITS_NUM_100011110 286
+#define __BITS_NUM_100011111 287
+#define __BITS_NUM_100100000 288
+#define __BITS_NUM_100100001 289
+#define __BITS_NUM_100100010 290
+#define __BITS_NUM_100100011 291
+#define __BITS_NUM_100100100 292
+#define __BITS_NUM_100100101 293
+#define __BITS_NUM_100100110 294
+#define __BITS_NUM_100100111 295
+#define __BITS_NUM_100101000 296
+#define __BITS_NUM_100101001 297
+#define __BITS_NUM_100101010 298
+#define __BITS_NUM_100101011 299
+#define __BITS_NUM_100101100 300
+#define __BITS_NUM_100101101 301
+#define __BITS_NUM_100101110 302
+#define __BITS_NUM_100101111 303
+#define __BITS_NUM_100110000 304
+#define __BITS_NUM_100110001 305
+#define __BITS_NUM_100110010 306
+#define __BITS_NUM_100110011 307
+#define __BITS_NUM_100110100 308
+#define __BITS_NUM_100110101 309
+#define __BITS_NUM_100110110 310
+#define __BITS_NUM_100110111 311
+#define __BITS_NUM_100111000 312
+#define __BITS_NUM_100111001 313
+#define __BITS_NUM_100111010 314
+#define __BITS_NUM_100111011 315
+#define __BITS_NUM_100111100 316
+#define __BITS_NUM_100111101 317
+#define __BITS_NUM_100111110 318
+#define __BITS_NUM_100111111 319
+#define __BITS_NUM_101000000 320
+#define __BITS_NUM_101000001 321
+#define __BITS_NUM_101000010 322
+#define __BITS_NUM_101000011 323
+#define __BITS_NUM_101000100 324
+#define __BITS_NUM_101000101 325
+#define __BITS_NUM_101000110 326
+#define __BITS_NUM_101000111 327
+#define __BITS_NUM_101001000 328
+#define __BITS_NUM_101001001 329
+#define __BITS_NUM_101001010 330
+#define __BITS_NUM_101001011 331
+#define __BITS_NUM_101001100 332
+#define __BITS_NUM_101001101 333
+#define __BITS_NUM_101001110 334
+#define __BITS_NUM_101001111 335
+#define __BITS_NUM_101010000 336
+#define __BITS_NUM_101010001 337
+#define __BITS_NUM_101010010 338
+#define __BITS_NUM_101010011 339
+#define __BITS_NUM_101010100 340
+#define __BITS_NUM_101010101 341
+#define __BITS_NUM_101010110 342
+#define __BITS_NUM_101010111 343
+#define __BITS_NUM_101011000 344
+#define __BITS_NUM_101011001 345
+#define __BITS_NUM_101011010 346
+#define __BITS_NUM_101011011 347
+#define __BITS_NUM_101011100 348
+#define __BITS_NUM_101011101 349
+#define __BITS_NUM_101011110 350
+#define __BITS_NUM_101011111 351
+#define __BITS_NUM_101100000 352
+#define __BITS_NUM_101100001 353
+#define __BITS_NUM_101100010 354
+#define __BITS_NUM_101100011 355
+#define __BITS_NUM_101100100 356
+#define __BITS_NUM_101100101 357
+#define __BITS_NUM_101100110 358
+#define __BITS_NUM_101100111 359
+#define __BITS_NUM_101101000 360
+#define __BITS_NUM_101101001 361
+#define __BITS_NUM_101101010 362
+#define __BITS_NUM_101101011 363
+#define __BITS_NUM_101101100 364
+#define __BITS_NUM_101101101 365
+#define __BITS_NUM_101101110 366
+#define __BITS_NUM_101101111 367
+#define __BITS_NUM_101110000 368
+#define __BITS_NUM_101110001 369
+#define __BITS_NUM_101110010 370
+#define __BITS_NUM_101110011 371
+#define __BITS_NUM_101110100 372
+#define __BITS_NUM_101110101 373
+#define __BITS_NUM_101110110 374
+#define __BITS_NUM_101110111 375
+#define __BITS_NUM_101111000 376
+#define __BITS_NUM_101111001 377
+#define __BITS_NUM_101111010 378
+#define __BITS_NUM_101111011 379
+#define __BITS_NUM_101111100 380
+#define __BITS_NUM_101111101 381
+#define __BITS_NUM_101111110 382
+#define __BITS_NUM_101111111 383
+#define __BITS_NUM_110000000 384
+#define __BITS_NUM_110000001 385
+#define __BITS_NUM_110000010 386
+#define __BITS_NUM_110000011 387
+#define __BITS_NUM_110000100 388
+#define __BITS_NUM_110000101 389
+#define __BITS_NUM_110000110 390
+#define __BITS_NUM_110000111 391
+#define __BITS_NUM_110001000 392
+#define __BITS_NUM_110001001 393
+#define __BITS_NUM_110001010 394
+#define __BITS_NUM_110001011 395
+#define __BITS_NUM_110001100 396
+#define __BITS_NUM_110001101 397
+#define __BITS_NUM_110001110 398
+#define __BITS_NUM_110001111 399
+#define __BITS_NUM_110010000 400
+#define __BITS_NUM_110010001 401
+#define __BITS_NUM_110010010 402
+#define __BITS_NUM_110010011 403
+#define __BITS_NUM_110010100 404
+#define __BITS_NUM_110010101 405
+#define __BITS_NUM_110010110 406
+#define __BITS_NUM_110010111 407
+#define __BITS_NUM_110011000 408
+#define __BITS_NUM_110011001 409
+#define __BITS_NUM_110011010 410
+#define __BITS_NUM_110011011 411
+#define __BITS_NUM_110011100 412
+#define __BITS_NUM_110011101 413
+#define __BITS_NUM_110011110 414
+#define __BITS_NUM_110011111 415
+#define __BITS_NUM_110100000 416
+#define __BITS_NUM_110100001 417
+#define __BITS_NUM_110100010 418
+#define __BITS_NUM_110100011 419
+#define __BITS_NUM_110100100 420
+#define __BITS_NUM_110100101 421
+#define __BITS_NUM_110100110 422
+#define __BITS_NUM_110100111 423
+#define __BITS_NUM_110101000 424
+#define __BITS_NUM_110101001 425
+#define __BITS_NUM_110101010 426
+#define __BITS_NUM_110101011 427
+#define __BITS_NUM_110101100 428
+#define __BITS_NUM_110101101 429
+#define __BITS_NUM_110101110 430
+#define __BITS_NUM_110101111 431
+#define __BITS_NUM_110110000 432
+#define __BITS_NUM_110110001 433
+#define __BITS_NUM_110110010 434
+#define __BITS_NUM_110110011 435
+#define __BITS_NUM_110110100 436
+#define __BITS_NUM_110110101 437
+#define __BITS_NUM_110110110 438
+#define __BITS_NUM_110110111 439
+#define __BITS_NUM_110111000 440
+#define __BITS_NUM_110111001 441
+#define __BITS_NUM_110111010 442
+#define __BITS_NUM_110111011 443
+#define __BITS_NUM_110111100 444
+#define __BITS_NUM_110111101 445
+#define __BITS_NUM_110111110 446
+#define __BITS_NUM_110111111 447
+#define __BITS_NUM_111000000 448
+#define __BITS_NUM_111000001 449
+#define __BITS_NUM_111000010 450
+#define __BITS_NUM_111000011 451
+#define __BITS_NUM_111000100 452
+#define __BITS_NUM_111000101 453
+#define __BITS_NUM_111000110 454
+#define __BITS_NUM_111000111 455
+#define __BITS_NUM_111001000 456
+#define __BITS_NUM_111001001 457
+#define __BITS_NUM_111001010 458
+#define __BITS_NUM_111001011 459
+#define __BITS_NUM_111001100 460
+#define __BITS_NUM_111001101 461
+#define __BITS_NUM_111001110 462
+#define __BITS_NUM_111001111 463
+#define __BITS_NUM_111010000 464
+#define __BITS_NUM_111010001 465
+#define __BITS_NUM_111010010 466
+#define __BITS_NUM_111010011 467
+#define __BITS_NUM_111010100 468
+#define __BITS_NUM_111010101 469
+#define __BITS_NUM_111010110 470
+#define __BITS_NUM_111010111 471
+#define __BITS_NUM_111011000 472
+#define __BITS_NUM_111011001 473
+#define __BITS_NUM_111011010 474
+#define __BITS_NUM_111011011 475
+#define __BITS_NUM_111011100 476
+#define __BITS_NUM_111011101 477
+#define __BITS_NUM_111011110 478
+#define __BITS_NUM_111011111 479
+#define __BITS_NUM_111100000 480
+#define __BITS_NUM_111100001 481
+#define __BITS_NUM_111100010 482
+#define __BITS_NUM_111100011 483
+#define __BITS_NUM_111100100 484
+#define __BITS_NUM_111100101 485
+#define __BITS_NUM_111100110 486
+#define __BITS_NUM_111100111 487
+#define __BITS_NUM_111101000 488
+#define __BITS_NUM_111101001 489
+#define __BITS_NUM_111101010 490
+#define __BITS_NUM_111101011 491
+#define __BITS_NUM_111101100 492
+#define __BITS_NUM_111101101 493
+#define __BITS_NUM_111101110 494
+#define __BITS_NUM_111101111 495
+#define __BITS_NUM_111110000 496
+#define __BITS_NUM_111110001 497
+#define __BITS_NUM_111110010 498
+#define __BITS_NUM_111110011 499
+#define __BITS_NUM_111110100 500
+#define __BITS_NUM_111110101 501
+#define __BITS_NUM_111110110 502
+#define __BITS_NUM_111110111 503
+#define __BITS_NUM_111111000 504
+#define __BITS_NUM_111111001 505
+#define __BITS_NUM_111111010 506
+#define __BITS_NUM_111111011 507
+#define __BITS_NUM_111111100 508
+#define __BITS_NUM_111111101 509
+#define __BITS_NUM_111111110 510
+#define __BITS_NUM_111111111 511
+
+/* population count */
+#define __POPCOUNT_0   0
+#define __POPCOUNT_1   1
+#define __POPCOUNT_2   1
+#define __POPCOUNT_3   2
+#define __POPCOUNT_4   1
+#define __POPCOUNT_5   2
+#define __POPCOUNT_6   2
+#define __POPCOUNT_7   3
+#define __POPCOUNT_8   1
+#define __POPCOUNT_9   2
+#define __POPCOUNT_10  2
+#define __POPCOUNT_11  3
+#define __POPCOUNT_12  2
+#define __POPCOUNT_13  3
+#define __POPCOUNT_14  3
+#define __POPCOUNT_15  4
+#define __POPCOUNT_16  1
+#define __POPCOUNT_17  2
+#define __POPCOUNT_18  2
+#define __POPCOUNT_19  3
+#define __POPCOUNT_20  2
+#define __POPCOUNT_21  3
+#define __POPCOUNT_22  3
+#define __POPCOUNT_23  4
+#define __POPCOUNT_24  2
+#define __POPCOUNT_25  3
+#define __POPCOUNT_26  3
+#define __POPCOUNT_27  4
+#define __POPCOUNT_28  3
+#define __POPCOUNT_29  4
+#define __POPCOUNT_30  4
+#define __POPCOUNT_31  5
+#define __POPCOUNT_32  1
+#define __POPCOUNT_33  2
+#define __POPCOUNT_34  2
+#define __POPCOUNT_35  3
+#define __POPCOUNT_36  2
+#define __POPCOUNT_37  3
+#define __POPCOUNT_38  3
+#define __POPCOUNT_39  4
+#define __POPCOUNT_40  2
+#define __POPCOUNT_41  3
+#define __POPCOUNT_42  3
+#define __POPCOUNT_43  4
+#define __POPCOUNT_44  3
+#define __POPCOUNT_45  4
+#define __POPCOUNT_46  4
+#define __POPCOUNT_47  5
+#define __POPCOUNT_48  2
+#define __POPCOUNT_49  3
+#define __POPCOUNT_50  3
+#define __POPCOUNT_51  4
+#define __POPCOUNT_52  3
+#define __POPCOUNT_53  4
+#define __POPCOUNT_54  4
+#define __POPCOUNT_55  5
+#define __POPCOUNT_56  3
+#define __POPCOUNT_57  4
+#define __POPCOUNT_58  4
+#define __POPCOUNT_59  5
+#define __POPCOUNT_60  4
+#define __POPCOUNT_61  5
+#define __POPCOUNT_62  5
+#define __POPCOUNT_63  6
+#define __POPCOUNT_64  1
+#define __POPCOUNT_65  2
+#define __POPCOUNT_66  2
+#define __POPCOUNT_67  3
+#define __POPCOUNT_68  2
+#define __POPCOUNT_69  3
+#define __POPCOUNT_70  3
+#define __POPCOUNT_71  4
+#define __POPCOUNT_72  2
+#define __POPCOUNT_73  3
+#define __POPCOUNT_74  3
+#define __POPCOUNT_75  4
+#define __POPCOUNT_76  3
+#define __POPCOUNT_77  4
+#define __POPCOUNT_78  4
+#define __POPCOUNT_79  5
+#define __POPCOUNT_80  2
+#define __POPCOUNT_81  3
+#define __POPCOUNT_82  3
+#define __POPCOUNT_83  4
+#define __POPCOUNT_84  3
+#define __POPCOUNT_85  4
+#define __POPCOUNT_86  4
+#define __POPCOUNT_87  5
+#define __POPCOUNT_88  3
+#define __POPCOUNT_89  4
+#define __POPCOUNT_90  4
+#define __POPCOUNT_91  5
+#define __POPCOUNT_92  4
+#define __POPCOUNT_93  5
+#define __POPCOUNT_94  5
+#define __POPCOUNT_95  6
+#define __POPCOUNT_96  2
+#define __POPCOUNT_97  3
+#define __POPCOUNT_98  3
+#define __POPCOUNT_99  4
+#define __POPCOUNT_100 3
+#define __POPCOUNT_101 4
+#define __POPCOUNT_102 4
+#define __POPCOUNT_103 5
+#define __POPCOUNT_104 3
+#define __POPCOUNT_105 4
+#define __POPCOUNT_106 4
+#define __POPCOUNT_107 5
+#define __POPCOUNT_108 4
+#define __POPCOUNT_109 5
+#define __POPCOUNT_110 5
+#define __POPCOUNT_111 6
+#define __POPCOUNT_112 3
+#define __POPCOUNT_113 4
+#define __POPCOUNT_114 4
+#define __POPCOUNT_115 5
+#define __POPCOUNT_116 4
+#define __POPCOUNT_117 5
+#define __POPCOUNT_118 5
+#define __POPCOUNT_119 6
+#define __POPCOUNT_120 4
+#define __POPCOUNT_121 5
+#define __POPCOUNT_122 5
+#define __POPCOUNT_123 6
+#define __POPCOUNT_124 5
+#define __POPCOUNT_125 6
+#define __POPCOUNT_126 6
+#define __POPCOUNT_127 7
+#define __POPCOUNT_128 1
+#define __POPCOUNT_129 2
+#define __POPCOUNT_130 2
+#define __POPCOUNT_131 3
+#define __POPCOUNT_132 2
+#define __POPCOUNT_133 3
+#define __POPCOUNT_134 3
+#define __POPCOUNT_135 4
+#define __POPCOUNT_136 2
+#define __POPCOUNT_137 3
+#define __POPCOUNT_138 3
+#define __POPCOUNT_139 4
+#define __POPCOUNT_140 3
+#define __POPCOUNT_141 4
+#define __POPCOUNT_142 4
+#define __POPCOUNT_143 5
+#define __POPCOUNT_144 2
+#define __POPCOUNT_145 3
+#define __POPCOUNT_146 3
+#define __POPCOUNT_147 4
+#define __POPCOUNT_148 3
+#define __POPCOUNT_149 4
+#define __POPCOUNT_150 4
+#define __POPCOUNT_151 5
+#define __POPCOUNT_152 3
+#define __POPCOUNT_153 4
+#define __POPCOUNT_154 4
+#define __POPCOUNT_155 5
+#define __POPCOUNT_156 4
+#define __POPCOUNT_157 5
+#define __POPCOUNT_158 5
+#define __POPCOUNT_159 6
+#define __POPCOUNT_160 2
+#define __POPCOUNT_161 3
+#define __POPCOUNT_162 3
+#define __POPCOUNT_163 4
+#define __POPCOUNT_164 3
+#define __POPCOUNT_165 4
+#define __POPCOUNT_166 4
+#define __POPCOUNT_167 5
+#define __POPCOUNT_168 3
+#define __POPCOUNT_169 4
+#define __POPCOUNT_170 4
+#define __POPCOUNT_171 5
+#define __POPCOUNT_172 4
+#define __POPCOUNT_173 5
+#define __POPCOUNT_174 5
+#define __POPCOUNT_175 6
+#define __POPCOUNT_176 3
+#define __POPCOUNT_177 4
+#define __POPCOUNT_178 4
+#define __POPCOUNT_179 5
+#define __POPCOUNT_180 4
+#define __POPCOUNT_181 5
+#define __POPCOUNT_182 5
+#define __POPCOUNT_183 6
+#define __POPCOUNT_184 4
+#define __POPCOUNT_185 5
+#define __POPCOUNT_186 5
+#define __POPCOUNT_187 6
+#define __POPCOUNT_188 5
+#define __POPCOUNT_189 6
+#define __POPCOUNT_190 6
+#define __POPCOUNT_191 7
+#define __POPCOUNT_192 2
+#define __POPCOUNT_193 3
+#define __POPCOUNT_194 3
+#define __POPCOUNT_195 4
+#define __POPCOUNT_196 3
+#define __POPCOUNT_197 4
+#define __POPCOUNT_198 4
+#define __POPCOUNT_199 5
+#define __POPCOUNT_200 3
+#define __POPCOUNT_201 4
+#define __POPCOUNT_202 4
+#define __POPCOUNT_203 5
+#define __POPCOUNT_204 4
+#define __POPCOUNT_205 5
+#define __POPCOUNT_206 5
+#define __POPCOUNT_207 6
+#define __POPCOUNT_208 3
+#define __POPCOUNT_209 4
+#define __POPCOUNT_210 4
+#define __POPCOUNT_211 5
+#define __POPCOUNT_212 4
+#define __POPCOUNT_213 5
+#define __POPCOUNT_214 5
+#define __POPCOUNT_215 6
+#define __POPCOUNT_216 4
+#define __POPCOUNT_217 5
+#define __POPCOUNT_218 5
+#define __POPCOUNT_219 6
+#define __POPCOUNT_220 5
+#define __POPCOUNT_221 6
+#define __POPCOUNT_222 6
+#define __POPCOUNT_223 7
+#define __POPCOUNT_224 3
+#define __POPCOUNT_225 4
+#define __POPCOUNT_226 4
+#define __POPCOUNT_227 5
+#define __POPCOUNT_228 4
+#define __POPCOUNT_229 5
+#define __POPCOUNT_230 5
+#define __POPCOUNT_231 6
+#define __POPCOUNT_232 4
+#define __POPCOUNT_233 5
+#define __POPCOUNT_234 5
+#define __POPCOUNT_235 6
+#define __POPCOUNT_236 5
+#define __POPCOUNT_237 6
+#define __POPCOUNT_238 6
+#define __POPCOUNT_239 7
+#define __POPCOUNT_240 4
+#define __POPCOUNT_241 5
+#define __POPCOUNT_242 5
+#define __POPCOUNT_243 6
+#define __POPCOUNT_244 5
+#define __POPCOUNT_245 6
+#define __POPCOUNT_246 6
+#define __POPCOUNT_247 7
+#define __POPCOUNT_248 5
+#define __POPCOUNT_249 6
+#define __POPCOUNT_250 6
+#define __POPCOUNT_251 7
+#define __POPCOUNT_252 6
+#define __POPCOUNT_253 7
+#define __POPCOUNT_254 7
+#define __POPCOUNT_255 8
+#define __POPCOUNT_256 1
+#define __POPCOUNT_257 2
+#define __POPCOUNT_258 2
+#define __POPCOUNT_259 3
+#define __POPCOUNT_260 2
+#define __POPCOUNT_261 3
+#define __POPCOUNT_262 3
+#define __POPCOUNT_263 4
+#define __POPCOUNT_264 2
+#define __POPCOUNT_265 3
+#define __POPCOUNT_266 3
+#define __POPCOUNT_267 4
+#define __POPCOUNT_268 3
+#define __POPCOUNT_269 4
+#define __POPCOUNT_270 4
+#define __POPCOUNT_271 5
+#define __POPCOUNT_272 2
+#define __POPCOUNT_273 3
+#define __POPCOUNT_274 3
+#define __POPCOUNT_275 4
+#define __POPCOUNT_276 3
+#define __POPCOUNT_277 4
+#define __POPCOUNT_278 4
+#define __POPCOUNT_279 5
+#define __POPCOUNT_280 3
+#define __POPCOUNT_281 4
+#define __POPCOUNT_282 4
+#define __POPCOUNT_283 5
+#define __POPCOUNT_284 4
+#define __POPCOUNT_285 5
+#define __POPCOUNT_286 5
+#define __POPCOUNT_287 6
+#define __POPCOUNT_288 2
+#define __POPCOUNT_289 3
+#define __POPCOUNT_290 3
+#define __POPCOUNT_291 4
+#define __POPCOUNT_292 3
+#define __POPCOUNT_293 4
+#define __POPCOUNT_294 4
+#define __POPCOUNT_295 5
+#define __POPCOUNT_296 3
+#define __POPCOUNT_297 4
+#define __POPCOUNT_298 4
+#define __POPCOUNT_299 5
+#define __POPCOUNT_300 4
+#define __POPCOUNT_301 5
+#define __POPCOUNT_302 5
+#define __POPCOUNT_303 6
+#define __POPCOUNT_304 3
+#define __POPCOUNT_305 4
+#define __POPCOUNT_306 4
+#define __POPCOUNT_307 5
+#define __POPCOUNT_308 4
+#define __POPCOUNT_309 5
+#define __POPCOUNT_310 5
+#define __POPCOUNT_311 6
+#define __POPCOUNT_312 4
+#define __POPCOUNT_313 5
+#define __POPCOUNT_314 5
+#define __POPCOUNT_315 6
+#define __POPCOUNT_316 5
+#define __POPCOUNT_317 6
+#define __POPCOUNT_318 6
+#define __POPCOUNT_319 7
+#define __POPCOUNT_320 2
+#define __POPCOUNT_321 3
+#define __POPCOUNT_322 3
+#define __POPCOUNT_323 4
+#define __POPCOUNT_324 3
+#define __POPCOUNT_325 4
+#define __POPCOUNT_326 4
+#define __POPCOUNT_327 5
+#define __POPCOUNT_328 3
+#define __POPCOUNT_329 4
+#define __POPCOUNT_330 4
+#define __POPCOUNT_331 5
+#define __POPCOUNT_332 4
+#define __POPCOUNT_333 5
+#define __POPCOUNT_334 5
+#define __POPCOUNT_335 6
+#define __POPCOUNT_336 3
+#define __POPCOUNT_337 4
+#define __POPCOUNT_338 4
+#define __POPCOUNT_339 5
+#define __POPCOUNT_340 4
+#define __POPCOUNT_341 5
+#define __POPCOUNT_342 5
+#define __POPCOUNT_343 6
+#define __POPCOUNT_344 4
+#define __POPCOUNT_345 5
+#define __POPCOUNT_346 5
+#define __POPCOUNT_347 6
+#define __POPCOUNT_348 5
+#define __POPCOUNT_349 6
+#define __POPCOUNT_350 6
+#define __POPCOUNT_351 7
+#define __POPCOUNT_352 3
+#define __POPCOUNT_353 4
+#define __POPCOUNT_354 4
+#define __POPCOUNT_355 5
+#define __POPCOUNT_356 4
+#define __POPCOUNT_357 5
+#define __POPCOUNT_358 5
+#define __POPCOUNT_359 6
+#define __POPCOUNT_360 4
+#define __POPCOUNT_361 5
+#define __POPCOUNT_362 5
+#define __POPCOUNT_363 6
+#define __POPCOUNT_364 5
+#define __POPCOUNT_365 6
+#define __POPCOUNT_366 6
+#define __POPCOUNT_367 7
+#define __POPCOUNT_368 4
+#define __POPCOUNT_369 5
+#define __POPCOUNT_370 5
+#define __POPCOUNT_371 6
+#define __POPCOUNT_372 5
+#define __POPCOUNT_373 6
+#define __POPCOUNT_374 6
+#define __POPCOUNT_375 7
+#define __POPCOUNT_376 5
+#define __POPCOUNT_377 6
+#define __POPCOUNT_378 6
+#define __POPCOUNT_379 7
+#define __POPCOUNT_380 6
+#define __POPCOUNT_381 7
+#define __POPCOUNT_382 7
+#define __POPCOUNT_383 8
+#define __POPCOUNT_384 2
+#define __POPCOUNT_385 3
+#define __POPCOUNT_386 3
+#define __POPCOUNT_387 4
+#define __POPCOUNT_388 3
+#define __POPCOUNT_389 4
+#define __POPCOUNT_390 4
+#define __POPCOUNT_391 5
+#define __POPCOUNT_392 3
+#define __POPCOUNT_393 4
+#define __POPCOUNT_394 4
+#define __POPCOUNT_395 5
+#define __POPCOUNT_396 4
+#define __POPCOUNT_397 5
+#define __POPCOUNT_398 5
+#define __POPCOUNT_399 6
+#define __POPCOUNT_400 3
+#define __POPCOUNT_401 4
+#define __POPCOUNT_402 4
+#define __POPCOUNT_403 5
+#define __POPCOUNT_404 4
+#define __POPCOUNT_405 5
+#define __POPCOUNT_406 5
+#define __POPCOUNT_407 6
+#define __POPCOUNT_408 4
+#define __POPCOUNT_409 5
+#define __POPCOUNT_410 5
+#define __POPCOUNT_411 6
+#define __POPCOUNT_412 5
+#define __POPCOUNT_413 6
+#define __POPCOUNT_414 6
+#define __POPCOUNT_415 7
+#define __POPCOUNT_416 3
+#define __POPCOUNT_417 4
+#define __POPCOUNT_418 4
+#define __POPCOUNT_419 5
+#define __POPCOUNT_420 4
+#define __POPCOUNT_421 5
+#define __POPCOUNT_422 5
+#define __POPCOUNT_423 6
+#define __POPCOUNT_424 4
+#define __POPCOUNT_425 5
+#define __POPCOUNT_426 5
+#define __POPCOUNT_427 6
+#define __POPCOUNT_428 5
+#define __POPCOUNT_429 6
+#define __POPCOUNT_430 6
+#define __POPCOUNT_431 7
+#define __POPCOUNT_432 4
+#define __POPCOUNT_433 5
+#define __POPCOUNT_434 5
+#define __POPCOUNT_435 6
+#define __POPCOUNT_436 5
+#define __POPCOUNT_437 6
+#define __POPCOUNT_438 6
+#define __POPCOUNT_439 7
+#define __POPCOUNT_440 5
+#define __POPCOUNT_441 6
+#define __POPCOUNT_442 6
+#define __POPCOUNT_443 7
+#define __POPCOUNT_444 6
+#define __POPCOUNT_445 7
+#define __POPCOUNT_446 7
+#define __POPCOUNT_447 8
+#define __POPCOUNT_448 3
+#define __POPCOUNT_449 4
+#define __POPCOUNT_450 4
+#define __POPCOUNT_451 5
+#define __POPCOUNT_452 4
+#define __POPCOUNT_453 5
+#define __POPCOUNT_454 5
+#define __POPCOUNT_455 6
+#define __POPCOUNT_456 4
+#define __POPCOUNT_457 5
+#define __POPCOUNT_458 5
+#define __POPCOUNT_459 6
+#define __POPCOUNT_460 5
+#define __POPCOUNT_461 6
+#define __POPCOUNT_462 6
+#define __POPCOUNT_463 7
+#define __POPCOUNT_464 4
+#define __POPCOUNT_465 5
+#define __POPCOUNT_466 5
+#define __POPCOUNT_467 6
+#define __POPCOUNT_468 5
+#define __POPCOUNT_469 6
+#define __POPCOUNT_470 6
+#define __POPCOUNT_471 7
+#define __POPCOUNT_472 5
+#define __POPCOUNT_473 6
+#define __POPCOUNT_474 6
+#define __POPCOUNT_475 7
+#define __POPCOUNT_476 6
+#define __POPCOUNT_477 7
+#define __POPCOUNT_478 7
+#define __POPCOUNT_479 8
+#define __POPCOUNT_480 4
+#define __POPCOUNT_481 5
+#define __POPCOUNT_482 5
+#define __POPCOUNT_483 6
+#define __POPCOUNT_484 5
+#define __POPCOUNT_485 6
+#define __POPCOUNT_486 6
+#define __POPCOUNT_487 7
+#define __POPCOUNT_488 5
+#define __POPCOUNT_489 6
+#define __POPCOUNT_490 6
+#define __POPCOUNT_491 7
+#define __POPCOUNT_492 6
+#define __POPCOUNT_493 7
+#define __POPCOUNT_494 7
+#define __POPCOUNT_495 8
+#define __POPCOUNT_496 5
+#define __POPCOUNT_497 6
+#define __POPCOUNT_498 6
+#define __POPCOUNT_499 7
+#define __POPCOUNT_500 6
+#define __POPCOUNT_501 7
+#define __POPCOUNT_502 7
+#define __POPCOUNT_503 8
+#define __POPCOUNT_504 6
+#define __POPCOUNT_505 7
+#define __POPCOUNT_506 7
+#define __POPCOUNT_507 8
+#define __POPCOUNT_508 7
+#define __POPCOUNT_509 8
+#define __POPCOUNT_510 8
+#define __POPCOUNT_511 9
+
+/* floor of base-2 logarithm (undefined for 0) */
+#define __LOG2_1   0
+#define __LOG2_2   1
+#define __LOG2_3   1
+#define __LOG2_4   2
+#define __LOG2_5   2
+#define __LOG2_6   2
+#define __LOG2_7   2
+#define __LOG2_8   3
+#define __LOG2_9   3
+#define __LOG2_10  3
+#define __LOG2_11  3
+#define __LOG2_12  3
+#define __LOG2_13  3
+#define __LOG2_14  3
+#define __LOG2_15  3
+#define __LOG2_16  4
+#define __LOG2_17  4
+#define __LOG2_18  4
+#define __LOG2_19  4
+#define __LOG2_20  4
+#define __LOG2_21  4
+#define __LOG2_22  4
+#define __LOG2_23  4
+#define __LOG2_24  4
+#define __LOG2_25  4
+#define __LOG2_26  4
+#define __LOG2_27  4
+#define __LOG2_28  4
+#define __LOG2_29  4
+#define __LOG2_30  4
+#define __LOG2_31  4
+#define __LOG2_32  5
+#define __LOG2_33  5
+#define __LOG2_34  5
+#define __LOG2_35  5
+#define __LOG2_36  5
+#define __LOG2_37  5
+#define __LOG2_38  5
+#define __LOG2_39  5
+#define __LOG2_40  5
+#define __LOG2_41  5
+#define __LOG2_42  5
+#define __LOG2_43  5
+#define __LOG2_44  5
+#define __LOG2_45  5
+#define __LOG2_46  5
+#define __LOG2_47  5
+#define __LOG2_48  5
+#define __LOG2_49  5
+#define __LOG2_50  5
+#define __LOG2_51  5
+#define __LOG2_52  5
+#define __LOG2_53  5
+#define __LOG2_54  5
+#define __LOG2_55  5
+#define __LOG2_56  5
+#define __LOG2_57  5
+#define __LOG2_58  5
+#define __LOG2_59  5
+#define __LOG2_60  5
+#define __LOG2_61  5
+#define __LOG2_62  5
+#define __LOG2_63  5
+#define __LOG2_64  6
+#define __LOG2_65  6
+#define __LOG2_66  6
+#define __LOG2_67  6
+#define __LOG2_68  6
+#define __LOG2_69  6
+#define __LOG2_70  6
+#define __LOG2_71  6
+#define __LOG2_72  6
+#define __LOG2_73  6
+#define __LOG2_74  6
+#define __LOG2_75  6
+#define __LOG2_76  6
+#define __LOG2_77  6
+#define __LOG2_78  6
+#define __LOG2_79  6
+#define __LOG2_80  6
+#define __LOG2_81  6
+#define __LOG2_82  6
+#define __LOG2_83  6
+#define __LOG2_84  6
+#define __LOG2_85  6
+#define __LOG2_86  6
+#define __LOG2_87  6
+#define __LOG2_88  6
+#define __LOG2_89  6
+#define __LOG2_90  6
+#define __LOG2_91  6
+#define __LOG2_92  6
+#define __LOG2_93  6
+#define __LOG2_94  6
+#define __LOG2_95  6
+#define __LOG2_96  6
+#define __LOG2_97  6
+#define __LOG2_98  6
+#define __LOG2_99  6
+#define __LOG2_100 6
+#define __LOG2_101 6
+#define __LOG2_102 6
+#define __LOG2_103 6
+#define __LOG2_104 6
+#define __LOG2_105 6
+#define __LOG2_106 6
+#define __LOG2_107 6
+#define __LOG2_108 6
+#define __LOG2_109 6
+#define __LOG2_110 6
+#define __LOG2_111 6
+#define __LOG2_112 6
+#define __LOG2_113 6
+#define __LOG2_114 6
+#define __LOG2_115 6
+#define __LOG2_116 6
+#define __LOG2_117 6
+#define __LOG2_118 6
+#define __LOG2_119 6
+#define __LOG2_120 6
+#define __LOG2_121 6
+#define __LOG2_122 6
+#define __LOG2_123 6
+#define __LOG2_124 6
+#define __LOG2_125 6
+#define __LOG2_126 6
+#define __LOG2_127 6
+#define __LOG2_128 7
+#define __LOG2_129 7
+#define __LOG2_130 7
+#define __LOG2_131 7
+#define __LOG2_132 7
+#define __LOG2_133 7
+#define __LOG2_134 7
+#define __LOG2_135 7
+#define __LOG2_136 7
+#define __LOG2_137 7
+#define __LOG2_138 7
+#define __LOG2_139 7
+#define __LOG2_140 7
+#define __LOG2_141 7
+#define __LOG2_142 7
+#define __LOG2_143 7
+#define __LOG2_144 7
+#define __LOG2_145 7
+#define __LOG2_146 7
+#define __LOG2_147 7
+#define __LOG2_148 7
+#define __LOG2_149 7
+#define __LOG2_150 7
+#define __LOG2_151 7
+#define __LOG2_152 7
+#define __LOG2_153 7
+#define __LOG2_154 7
+#define __LOG2_155 7
+#define __LOG2_156 7
+#define __LOG2_157 7
+#define __LOG2_158 7
+#define __LOG2_159 7
+#define __LOG2_160 7
+#define __LOG2_161 7
+#define __LOG2_162 7
+#define __LOG2_163 7
+#define __LOG2_164 7
+#define __LOG2_165 7
+#define __LOG2_166 7
+#define __LOG2_167 7
+#define __LOG2_168 7
+#define __LOG2_169 7
+#define __LOG2_170 7
+#define __LOG2_171 7
+#define __LOG2_172 7
+#define __LOG2_173 7
+#define __LOG2_174 7
+#define __LOG2_175 7
+#define __LOG2_176 7
+#define __LOG2_177 7
+#define __LOG2_178 7
+#define __LOG2_179 7
+#define __LOG2_180 7
+#define __LOG2_181 7
+#define __LOG2_182 7
+#define __LOG2_183 7
+#define __LOG2_184 7
+#define __LOG2_185 7
+#define __LOG2_186 7
+#define __LOG2_187 7
+#define __LOG2_188 7
+#define __LOG2_189 7
+#define __LOG2_190 7
+#define __LOG2_191 7
+#define __LOG2_192 7
+#define __LOG2_193 7
+#define __LOG2_194 7
+#define __LOG2_195 7
+#define __LOG2_196 7
+#define __LOG2_197 7
+#define __LOG2_198 7
+#define __LOG2_199 7
+#define __LOG2_200 7
+#define __LOG2_201 7
+#define __LOG2_202 7
+#define __LOG2_203 7
+#define __LOG2_204 7
+#define __LOG2_205 7
+#define __LOG2_206 7
+#define __LOG2_207 7
+#define __LOG2_208 7
+#define __LOG2_209 7
+#define __LOG2_210 7
+#define __LOG2_211 7
+#define __LOG2_212 7
+#define __LOG2_213 7
+#define __LOG2_214 7
+#define __LOG2_215 7
+#define __LOG2_216 7
+#define __LOG2_217 7
+#define __LOG2_218 7
+#define __LOG2_219 7
+#define __LOG2_220 7
+#define __LOG2_221 7
+#define __LOG2_222 7
+#define __LOG2_223 7
+#define __LOG2_224 7
+#define __LOG2_225 7
+#define __LOG2_226 7
+#define __LOG2_227 7
+#define __LOG2_228 7
+#define __LOG2_229 7
+#define __LOG2_230 7
+#define __LOG2_231 7
+#define __LOG2_232 7
+#define __LOG2_233 7
+#define __LOG2_234 7
+#define __LOG2_235 7
+#define __LOG2_236 7
+#define __LOG2_237 7
+#define __LOG2_238 7
+#define __LOG2_239 7
+#define __LOG2_240 7
+#define __LOG2_241 7
+#define __LOG2_242 7
+#define __LOG2_243 7
+#define __LOG2_244 7
+#define __LOG2_245 7
+#define __LOG2_246 7
+#define __LOG2_247 7
+#define __LOG2_248 7
+#define __LOG2_249 7
+#define __LOG2_250 7
+#define __LOG2_251 7
+#define __LOG2_252 7
+#define __LOG2_253 7
+#define __LOG2_254 7
+#define __LOG2_255 7
+#define __LOG2_256 8
+#define __LOG2_257 8
+#define __LOG2_258 8
+#define __LOG2_259 8
+#define __LOG2_260 8
+#define __LOG2_261 8
+#define __LOG2_262 8
+#define __LOG2_263 8
+#define __LOG2_264 8
+#define __LOG2_265 8
+#define __LOG2_266 8
+#define __LOG2_267 8
+#define __LOG2_268 8
+#define __LOG2_269 8
+#define __LOG2_270 8
+#define __LOG2_271 8
+#define __LOG2_272 8
+#define __LOG2_273 8
+#define __LOG2_274 8
+#define __LOG2_275 8
+#define __LOG2_276 8
+#define __LOG2_277 8
+#define __LOG2_278 8
+#define __LOG2_279 8
+#define __LOG2_280 8
+#define __LOG2_281 8
+#define __LOG2_282 8
+#define __LOG2_283 8
+#define __LOG2_284 8
+#define __LOG2_285 8
+#define __LOG2_286 8
+#define __LOG2_287 8
+#define __LOG2_288 8
+#define __LOG2_289 8
+#define __LOG2_290 8
+#define __LOG2_291 8
+#define __LOG2_292 8
+#define __LOG2_293 8
+#define __LOG2_294 8
+#define __LOG2_295 8
+#define __LOG2_296 8
+#define __LOG2_297 8
+#define __LOG2_298 8
+#define __LOG2_299 8
+#define __LOG2_300 8
+#define __LOG2_301 8
+#define __LOG2_302 8
+#define __LOG2_303 8
+#define __LOG2_304 8
+#define __LOG2_305 8
+#define __LOG2_306 8
+#define __LOG2_307 8
+#define __LOG2_308 8
+#define __LOG2_309 8
+#define __LOG2_310 8
+#define __LOG2_311 8
+#define __LOG2_312 8
+#define __LOG2_313 8
+#define __LOG2_314 8
+#define __LOG2_315 8
+#define __LOG2_316 8
+#define __LOG2_317 8
+#define __LOG2_318 8
+#define __LOG2_319 8
+#define __LOG2_320 8
+#define __LOG2_321 8
+#define __LOG2_322 8
+#define __LOG2_323 8
+#define __LOG2_324 8
+#define __LOG2_325 8
+#define __LOG2_326 8
+#define __LOG2_327 8
+#define __LOG2_328 8
+#define __LOG2_329 8
+#define __LOG2_330 8
+#define __LOG2_331 8
+#define __LOG2_332 8
+#define __LOG2_333 8
+#define __LOG2_334 8
+#define __LOG2_335 8
+#define __LOG2_336 8
+#define __LOG2_337 8
+#define __LOG2_338 8
+#define __LOG2_339 8
+#define __LOG2_340 8
+#define __LOG2_341 8
+#define __LOG2_342 8
+#define __LOG2_343 8
+#define __LOG2_344 8
+#define __LOG2_345 8
+#define __LOG2_346 8
+#define __LOG2_347 8
+#define __LOG2_348 8
+#define __LOG2_349 8
+#define __LOG2_350 8
+#define __LOG2_351 8
+#define __LOG2_352 8
+#define __LOG2_353 8
+#define __LOG2_354 8
+#define __LOG2_355 8
+#define __LOG2_356 8
+#define __LOG2_357 8
+#define __LOG2_358 8
+#define __LOG2_359 8
+#define __LOG2_360 8
+#define __LOG2_361 8
+#define __LOG2_362 8
+#define __LOG2_363 8
+#define __LOG2_364 8
+#define __LOG2_365 8
+#define __LOG2_366 8
+#define __LOG2_367 8
+#define __LOG2_368 8
+#define __LOG2_369 8
+#define __LOG2_370 8
+#define __LOG2_371 8
+#define __LOG2_372 8
+#define __LOG2_373 8
+#define __LOG2_374 8
+#define __LOG2_375 8
+#define __LOG2_376 8
+#define __LOG2_377 8
+#define __LOG2_378 8
+#define __LOG2_379 8
+#define __LOG2_380 8
+#define __LOG2_381 8
+#define __LOG2_382 8
+#define __LOG2_383 8
+#define __LOG2_384 8
+#define __LOG2_385 8
+#define __LOG2_386 8
+#define __LOG2_387 8
+#define __LOG2_388 8
+#define __LOG2_389 8
+#define __LOG2_390 8
+#define __LOG2_391 8
+#define __LOG2_392 8
+#define __LOG2_393 8
+#define __LOG2_394 8
+#define __LOG2_395 8
+#define __LOG2_396 8
+#define __LOG2_397 8
+#define __LOG2_398 8
+#define __LOG2_399 8
+#define __LOG2_400 8
+#define __LOG2_401 8
+#define __LOG2_402 8
+#define __LOG2_403 8
+#define __LOG2_404 8
+#define __LOG2_405 8
+#define __LOG2_406 8
+#define __LOG2_407 8
+#define __LOG2_408 8
+#define __LOG2_409 8
+#define __LOG2_410 8
+#define __LOG2_411 8
+#define __LOG2_412 8
+#define __LOG2_413 8
+#define __LOG2_414 8
+#define __LOG2_415 8
+#define __LOG2_416 8
+#define __LOG2_417 8
+#define __LOG2_418 8
+#define __LOG2_419 8
+#define __LOG2_420 8
+#define __LOG2_421 8
+#define __LOG2_422 8
+#define __LOG2_423 8
+#define __LOG2_424 8
+#define __LOG2_425 8
+#define __LOG2_426 8
+#define __LOG2_427 8
+#define __LOG2_428 8
+#define __LOG2_429 8
+#define __LOG2_430 8
+#define __LOG2_431 8
+#define __LOG2_432 8
+#define __LOG2_433 8
+#define __LOG2_434 8
+#define __LOG2_435 8
+#define __LOG2_436 8
+#define __LOG2_437 8
+#define __LOG2_438 8
+#define __LOG2_439 8
+#define __LOG2_440 8
+#define __LOG2_441 8
+#define __LOG2_442 8
+#define __LOG2_443 8
+#define __LOG2_444 8
+#define __LOG2_445 8
+#define __LOG2_446 8
+#define __LOG2_447 8
+#define __LOG2_448 8
+#define __LOG2_449 8
+#define __LOG2_450 8
+#define __LOG2_451 8
+#define __LOG2_452 8
+#define __LOG2_453 8
+#define __LOG2_454 8
+#define __LOG2_455 8
+#define __LOG2_456 8
+#define __LOG2_457 8
+#define __LOG2_458 8
+#define __LOG2_459 8
+#define __LOG2_460 8
+#define __LOG2_461 8
+#define __LOG2_462 8
+#define __LOG2_463 8
+#define __LOG2_464 8
+#define __LOG2_465 8
+#define __LOG2_466 8
+#define __LOG2_467 8
+#define __LOG2_468 8
+#define __LOG2_469 8
+#define __LOG2_470 8
+#define __LOG2_471 8
+#define __LOG2_472 8
+#define __LOG2_473 8
+#define __LOG2_474 8
+#define __LOG2_475 8
+#define __LOG2_476 8
+#define __LOG2_477 8
+#define __LOG2_478 8
+#define __LOG2_479 8
+#define __LOG2_480 8
+#define __LOG2_481 8
+#define __LOG2_482 8
+#define __LOG2_483 8
+#define __LOG2_484 8
+#define __LOG2_485 8
+#define __LOG2_486 8
+#define __LOG2_487 8
+#define __LOG2_488 8
+#define __LOG2_489 8
+#define __LOG2_490 8
+#define __LOG2_491 8
+#define __LOG2_492 8
+#define __LOG2_493 8
+#define __LOG2_494 8
+#define __LOG2_495 8
+#define __LOG2_496 8
+#define __LOG2_497 8
+#define __LOG2_498 8
+#define __LOG2_499 8
+#define __LOG2_500 8
+#define __LOG2_501 8
+#define __LOG2_502 8
+#define __LOG2_503 8
+#define __LOG2_504 8
+#define __LOG2_505 8
+#define __LOG2_506 8
+#define __LOG2_507 8
+#define __LOG2_508 8
+#define __LOG2_509 8
+#define __LOG2_510 8
+#define __LOG2_511 8
+
+/* least power of 2 not less than n */
+#define __NEXT_POW2_0   1
+#define __NEXT_POW2_1   1
+#define __NEXT_POW2_2   2
+#define __NEXT_POW2_3   4
+#define __NEXT_POW2_4   4
+#define __NEXT_POW2_5   8
+#define __NEXT_POW2_6   8
+#define __NEXT_POW2_7   8
+#define __NEXT_POW2_8   8
+#define __NEXT_POW2_9   16
+#define __NEXT_POW2_10  16
+#define __NEXT_POW2_11  16
+#define __NEXT_POW2_12  16
+#define __NEXT_POW2_13  16
+#define __NEXT_POW2_14  16
+#define __NEXT_POW2_15  16
+#define __NEXT_POW2_16  16
+#define __NEXT_POW2_17  32
+#define __NEXT_POW2_18  32
+#define __NEXT_POW2_19  32
+#define __NEXT_POW2_20  32
+#define __NEXT_POW2_21  32
+#define __NEXT_POW2_22  32
+#define __NEXT_POW2_23  32
+#define __NEXT_POW2_24  32
+#define __NEXT_POW2_25  32
+#define __NEXT_POW2_26  32
+#define __NEXT_POW2_27  32
+#define __NEXT_POW2_28  32
+#define __NEXT_POW2_29  32
+#define __NEXT_POW2_30  32
+#define __NEXT_POW2_31  32
+#define __NEXT_POW2_32  32
+#define __NEXT_POW2_33  64
+#define __NEXT_POW2_34  64
+#define __NEXT_POW2_35  64
+#define __NEXT_POW2_36  64
+#define __NEXT_POW2_37  64
+#define __NEXT_POW2_38  64
+#define __NEXT_POW2_39  64
+#define __NEXT_POW2_40  64
+#define __NEXT_POW2_41  64
+#define __NEXT_POW2_42  64
+#define __NEXT_POW2_43  64
+#define __NEXT_POW2_44  64
+#define __NEXT_POW2_45  64
+#define __NEXT_POW2_46  64
+#define __NEXT_POW2_47  64
+#define __NEXT_POW2_48  64
+#define __NEXT_POW2_49  64
+#define __NEXT_POW2_50  64
+#define __NEXT_POW2_51  64
+#define __NEXT_POW2_52  64
+#define __NEXT_POW2_53  64
+#define __NEXT_POW2_54  64
+#define __NEXT_POW2_55  64
+#define __NEXT_POW2_56  64
+#define __NEXT_POW2_57  64
+#define __NEXT_POW2_58  64
+#define __NEXT_POW2_59  64
+#define __NEXT_POW2_60  64
+#define __NEXT_POW2_61  64
+#define __NEXT_POW2_62  64
+#define __NEXT_POW2_63  64
+#define __NEXT_POW2_64  64
+#define __NEXT_POW2_65  128
+#define __NEXT_POW2_66  128
+#define __NEXT_POW2_67  128
+#define __NEXT_POW2_68  128
+#define __NEXT_POW2_69  128
+#define __NEXT_POW2_70  128
+#define __NEXT_POW2_71  128
+#define __NEXT_POW2_72  128
+#define __NEXT_POW2_73  128
+#define __NEXT_POW2_74  128
+#define __NEXT_POW2_75  128
+#define __NEXT_POW2_76  128
+#define __NEXT_POW2_77  128
+#define __NEXT_POW2_78  128
+#define __NEXT_POW2_79  128
+#define __NEXT_POW2_80  128
+#define __NEXT_POW2_81  128
+#define __NEXT_POW2_82  128
+#define __NEXT_POW2_83  128
+#define __NEXT_POW2_84  128
+#define __NEXT_POW2_85  128
+#define __NEXT_POW2_86  128
+#define __NEXT_POW2_87  128
+#define __NEXT_POW2_88  128
+#define __NEXT_POW2_89  128
+#define __NEXT_POW2_90  128
+#define __NEXT_POW2_91  128
+#define __NEXT_POW2_92  128
+#define __NEXT_POW2_93  128
+#define __NEXT_POW2_94  128
+#define __NEXT_POW2_95  128
+#define __NEXT_POW2_96  128
+#define __NEXT_POW2_97  128
+#define __NEXT_POW2_98  128
+#define __NEXT_POW2_99  128
+#define __NEXT_POW2_100 128
+#define __NEXT_POW2_101 128
+#define __NEXT_POW2_102 128
+#define __NEXT_POW2_103 128
+#define __NEXT_POW2_104 128
+#define __NEXT_POW2_105 128
+#define __NEXT_POW2_106 128
+#define __NEXT_POW2_107 128
+#define __NEXT_POW2_108 128
+#define __NEXT_POW2_109 128
+#define __NEXT_POW2_110 128
+#define __NEXT_POW2_111 128
+#define __NEXT_POW2_112 128
+#define __NEXT_POW2_113 128
+#define __NEXT_POW2_114 128
+#define __NEXT_POW2_115 128
+#define __NEXT_POW2_116 128
+#define __NEXT_POW2_117 128
+#define __NEXT_POW2_118 128
+#define __NEXT_POW2_119 128
+#define __NEXT_POW2_120 128
+#define __NEXT_POW2_121 128
+#define __NEXT_POW2_122 128
+#define __NEXT_POW2_123 128
+#define __NEXT_POW2_124 128
+#define __NEXT_POW2_125 128
+#define __NEXT_POW2_126 128
+#define __NEXT_POW2_127 128
+#define __NEXT_POW2_128 128
+#define __NEXT_POW2_129 256
+#define __NEXT_POW2_130 256
+#define __NEXT_POW2_131 256
+#define __NEXT_POW2_132 256
+#define __NEXT_POW2_133 256
+#define __NEXT_POW2_134 256
+#define __NEXT_POW2_135 256
+#define __NEXT_POW2_136 256
+#define __NEXT_POW2_137 256
+#define __NEXT_POW2_138 256
+#define __NEXT_POW2_139 256
+#define __NEXT_POW2_140 256
+#define __NEXT_POW2_141 256
+#define __NEXT_POW2_142 256
+#define __NEXT_POW2_143 256
+#define __NEXT_POW2_144 256
+#define __NEXT_POW2_145 256
+#define __NEXT_POW2_146 256
+#define __NEXT_POW2_147 256
+#define __NEXT_POW2_148 256
+#define __NEXT_POW2_149 256
+#define __NEXT_POW2_150 256
+#define __NEXT_POW2_151 256
+#define __NEXT_POW2_152 256
+#define __NEXT_POW2_153 256
+#define __NEXT_POW2_154 256
+#define __NEXT_POW2_155 256
+#define __NEXT_POW2_156 256
+#define __NEXT_POW2_157 256
+#define __NEXT_POW2_158 256
+#define __NEXT_POW2_159 256
+#define __NEXT_POW2_160 256
+#define __NEXT_POW2_161 256
+#define __NEXT_POW2_162 256
+#define __NEXT_POW2_163 256
+#define __NEXT_POW2_164 256
+#define __NEXT_POW2_165 256
+#define __NEXT_POW2_166 256
+#define __NEXT_POW2_167 256
+#define __NEXT_POW2_168 256
+#define __NEXT_POW2_169 256
+#define __NEXT_POW2_170 256
+#define __NEXT_POW2_171 256
+#define __NEXT_POW2_172 256
+#define __NEXT_POW2_173 256
+#define __NEXT_POW2_174 256
+#define __NEXT_POW2_175 256
+#define __NEXT_POW2_176 256
+#define __NEXT_POW2_177 256
+#define __NEXT_POW2_178 256
+#define __NEXT_POW2_179 256
+#define __NEXT_POW2_180 256
+#define __NEXT_POW2_181 256
+#define __NEXT_POW2_182 256
+#define __NEXT_POW2_183 256
+#define __NEXT_POW2_184 256
+#define __NEXT_POW2_185 256
+#define __NEXT_POW2_186 256
+#define __NEXT_POW2_187 256
+#define __NEXT_POW2_188 256
+#define __NEXT_POW2_189 256
+#define __NEXT_POW2_190 256
+#define __NEXT_POW2_191 256
+#define __NEXT_POW2_192 256
+#define __NEXT_POW2_193 256
+#define __NEXT_POW2_194 256
+#define __NEXT_POW2_195 256
+#define __NEXT_POW2_196 256
+#define __NEXT_POW2_197 256
+#define __NEXT_POW2_198 256
+#define __NEXT_POW2_199 256
+#define __NEXT_POW2_200 256
+#define __NEXT_POW2_201 256
+#define __NEXT_POW2_202 256
+#define __NEXT_POW2_203 256
+#define __NEXT_POW2_204 256
+#define __NEXT_POW2_205 256
+#define __NEXT_POW2_206 256
+#define __NEXT_POW2_207 256
+#define __NEXT_POW2_208 256
+#define __NEXT_POW2_209 256
+#define __NEXT_POW2_210 256
+#define __NEXT_POW2_211 256
+#define __NEXT_POW2_212 256
+#define __NEXT_POW2_213 256
+#define __NEXT_POW2_214 256
+#define __NEXT_POW2_215 256
+#define __NEXT_POW2_216 256
+#define __NEXT_POW2_217 256
+#define __NEXT_POW2_218 256
+#define __NEXT_POW2_219 256
+#define __NEXT_POW2_220 256
+#define __NEXT_POW2_221 256
+#define __NEXT_POW2_222 256
+#define __NEXT_POW2_223 256
+#define __NEXT_POW2_224 256
+#define __NEXT_POW2_225 256
+#define __NEXT_POW2_226 256
+#define __NEXT_POW2_227 256
+#define __NEXT_POW2_228 256
+#define __NEXT_POW2_229 256
+#define __NEXT_POW2_230 256
+#define __NEXT_POW2_231 256
+#define __NEXT_POW2_232 256
+#define __NEXT_POW2_233 256
+#define __NEXT_POW2_234 256
+#define __NEXT_POW2_235 256
+#define __NEXT_POW2_236 256
+#define __NEXT_POW2_237 256
+#define __NEXT_POW2_238 256
+#define __NEXT_POW2_239 256
+#define __NEXT_POW2_240 256
+#define __NEXT_POW2_241 256
+#define __NEXT_POW2_242 256
+#define __NEXT_POW2_243 256
+#define __NEXT_POW2_244 256
+#define __NEXT_POW2_245 256
+#define __NEXT_POW2_246 256
+#define __NEXT_POW2_247 256
+#define __NEXT_POW2_248 256
+#define __NEXT_POW2_249 256
+#define __NEXT_POW2_250 256
+#define __NEXT_POW2_251 256
+#define __NEXT_POW2_252 256
+#define __NEXT_POW2_253 256
+#define __NEXT_POW2_254 256
+#define __NEXT_POW2_255 256
+#define __NEXT_POW2_256 256
+#define __NEXT_POW2_257 512
+#define __NEXT_POW2_258 512
+#define __NEXT_POW2_259 512
+#define __NEXT_POW2_260 512
+#define __NEXT_POW2_261 512
+#define __NEXT_POW2_262 512
+#define __NEXT_POW2_263 512
+#define __NEXT_POW2_264 512
+#define __NEXT_POW2_265 512
+#define __NEXT_POW2_266 512
+#define __NEXT_POW2_267 512
+#define __NEXT_POW2_268 512
+#define __NEXT_POW2_269 512
+#define __NEXT_POW2_270 512
+#define __NEXT_POW2_271 512
+#define __NEXT_POW2_272 512
+#define __NEXT_POW2_273 512
+#define __NEXT_POW2_274 512
+#define __NEXT_POW2_275 512
+#define __NEXT_POW2_276 512
+#define __NEXT_POW2_277 512
+#define __NEXT_POW2_278 512
+#define __NEXT_POW2_279 512
+#define __NEXT_POW2_280 512
+#define __NEXT_POW2_281 512
+#define __NEXT_POW2_282 512
+#define __NEXT_POW2_283 512
+#define __NEXT_POW2_284 512
+#define __NEXT_POW2_285 512
+#define __NEXT_POW2_286 512
+#define __NEXT_POW2_287 512
+#define __NEXT_POW2_288 512
+#define __NEXT_POW2_289 512
+#define __NEXT_POW2_290 512
+#define __NEXT_POW2_291 512
+#define __NEXT_POW2_292 512
+#define __NEXT_POW2_293 512
+#define __NEXT_POW2_294 512
+#define __NEXT_POW2_295 512
+#define __NEXT_POW2_296 512
+#define __NEXT_POW2_297 512
+#define __NEXT_POW2_298 512
+#define __NEXT_POW2_299 512
+#define __NEXT_POW2_300 512
+#define __NEXT_POW2_301 512
+#define __NEXT_POW2_302 512
+#define __NEXT_POW2_303 512
+#define __NEXT_POW2_304 512
+#define __NEXT_POW2_305 512
+#define __NEXT_POW2_306 512
+#define __NEXT_POW2_307 512
+#define __NEXT_POW2_308 512
+#define __NEXT_POW2_309 512
+#define __NEXT_POW2_310 512
+#define __NEXT_POW2_311 512
+#define __NEXT_POW2_312 512
+#define __NEXT_POW2_313 512
+#define __NEXT_POW2_314 512
+#define __NEXT_POW2_315 512
+#define __NEXT_POW2_316 512
+#define __NEXT_POW2_317 512
+#define __NEXT_POW2_318 512
+#define __NEXT_POW2_319 512
+#define __NEXT_POW2_320 512
+#define __NEXT_POW2_321 512
+#define __NEXT_POW2_322 512
+#define __NEXT_POW2_323 512
+#define __NEXT_POW2_324 512
+#define __NEXT_POW2_325 512
+#define __NEXT_POW2_326 512
+#define __NEXT_POW2_327 512
+#define __NEXT_POW2_328 512
+#define __NEXT_POW2_329 512
+#define __NEXT_POW2_330 512
+#define __NEXT_POW2_331 512
+#define __NEXT_POW2_332 512
+#define __NEXT_POW2_333 512
+#define __NEXT_POW2_334 512
+#define __NEXT_POW2_335 512
+#define __NEXT_POW2_336 512
+#define __NEXT_POW2_337 512
+#define __NEXT_POW2_338 512
+#define __NEXT_POW2_339 512
+#define __NEXT_POW2_340 512
+#define __NEXT_POW2_341 512
+#define __NEXT_POW2_342 512
+#define __NEXT_POW2_343 512
+#define __NEXT_POW2_344 512
+#define __NEXT_POW2_345 512
+#define __NEXT_POW2_346 512
+#define __NEXT_POW2_347 512
+#define __NEXT_POW2_348 512
+#define __NEXT_POW2_349 512
+#define __NEXT_POW2_350 512
+#define __NEXT_POW2_351 512
+#define __NEXT_POW2_352 512
+#define __NEXT_POW2_353 512
+#define __NEXT_POW2_354 512
+#define __NEXT_POW2_355 512
+#define __NEXT_POW2_356 512
+#define __NEXT_POW2_357 512
+#define __NEXT_POW2_358 512
+#define __NEXT_POW2_359 512
+#define __NEXT_POW2_360 512
+#define __NEXT_POW2_361 512
+#define __NEXT_POW2_362 512
+#define __NEXT_POW2_363 512
+#define __NEXT_POW2_364 512
+#define __NEXT_POW2_365 512
+#define __NEXT_POW2_366 512
+#define __NEXT_POW2_367 512
+#define __NEXT_POW2_368 512
+#define __NEXT_POW2_369 512
+#define __NEXT_POW2_370 512
+#define __NEXT_POW2_371 512
+#define __NEXT_POW2_372 512
+#define __NEXT_POW2_373 512
+#define __NEXT_POW2_374 512
+#define __NEXT_POW2_375 512
+#define __NEXT_POW2_376 512
+#define __NEXT_POW2_377 512
+#define __NEXT_POW2_378 512
+#define __NEXT_POW2_379 512
+#define __NEXT_POW2_380 512
+#define __NEXT_POW2_381 512
+#define __NEXT_POW2_382 512
+#define __NEXT_POW2_383 512
+#define __NEXT_POW2_384 512
+#define __NEXT_POW2_385 512
+#define __NEXT_POW2_386 512
+#define __NEXT_POW2_387 512
+#define __NEXT_POW2_388 512
+#define __NEXT_POW2_389 512
+#define __NEXT_POW2_390 512
+#define __NEXT_POW2_391 512
+#define __NEXT_POW2_392 512
+#define __NEXT_POW2_393 512
+#define __NEXT_POW2_394 512
+#define __NEXT_POW2_395 512
+#define __NEXT_POW2_396 512
+#define __NEXT_POW2_397 512
+#define __NEXT_POW2_398 512
+#define __NEXT_POW2_399 512
+#define __NEXT_POW2_400 512
+#define __NEXT_POW2_401 512
+#define __NEXT_POW2_402 512
+#define __NEXT_POW2_403 512
+#define __NEXT_POW2_404 512
+#define __NEXT_POW2_405 512
+#define __NEXT_POW2_406 512
+#define __NEXT_POW2_407 512
+#define __NEXT_POW2_408 512
+#define __NEXT_POW2_409 512
+#define __NEXT_POW2_410 512
+#define __NEXT_POW2_411 512
+#define __NEXT_POW2_412 512
+#define __NEXT_POW2_413 512
+#define __NEXT_POW2_414 512
+#define __NEXT_POW2_415 512
+#define __NEXT_POW2_416 512
+#define __NEXT_POW2_417 512
+#define __NEXT_POW2_418 512
+#define __NEXT_POW2_419 512
+#define __NEXT_POW2_420 512
+#define __NEXT_POW2_421 512
+#define __NEXT_POW2_422 512
+#define __NEXT_POW2_423 512
+#define __NEXT_POW2_424 512
+#define __NEXT_POW2_425 512
+#define __NEXT_POW2_426 512
+#define __NEXT_POW2_427 512
+#define __NEXT_POW2_428 512
+#define __NEXT_POW2_429 512
+#define __NEXT_POW2_430 512
+#define __NEXT_POW2_431 512
+#define __NEXT_POW2_432 512
+#define __NEXT_POW2_433 512
+#define __NEXT_POW2_434 512
+#define __NEXT_POW2_435 512
+#define __NEXT_POW2_436 512
+#define __NEXT_POW2_437 512
+#define __NEXT_POW2_438 512
+#define __NEXT_POW2_439 512
+#define __NEXT_POW2_440 512
+#define __NEXT_POW2_441 512
+#define __NEXT_POW2_442 512
+#define __NEXT_POW2_443 512
+#define __NEXT_POW2_444 512
+#define __NEXT_POW2_445 512
+#define __NEXT_POW2_446 512
+#define __NEXT_POW2_447 512
+#define __NEXT_POW2_448 512
+#define __NEXT_POW2_449 512
+#define __NEXT_POW2_450 512
+#define __NEXT_POW2_451 512
+#define __NEXT_POW2_452 512
+#define __NEXT_POW2_453 512
+#define __NEXT_POW2_454 512
+#define __NEXT_POW2_455 512
+#define __NEXT_POW2_456 512
+#define __NEXT_POW2_457 512
+#define __NEXT_POW2_458 512
+#define __NEXT_POW2_459 512
+#define __NEXT_POW2_460 512
+#define __NEXT_POW2_461 512
+#define __NEXT_POW2_462 512
+#define __NEXT_POW2_463 512
+#define __NEXT_POW2_464 512
+#define __NEXT_POW2_465 512
+#define __NEXT_POW2_466 512
+#define __NEXT_POW2_467 512
+#define __NEXT_POW2_468 512
+#define __NEXT_POW2_469 512
+#define __NEXT_POW2_470 512
+#define __NEXT_POW2_471 512
+#define __NEXT_POW2_472 512
+#define __NEXT_POW2_473 512
+#define __NEXT_POW2_474 512
+#define __NEXT_POW2_475 512
+#define __NEXT_POW2_476 512
+#define __NEXT_POW2_477 512
+#define __NEXT_POW2_478 512
+#define __NEXT_POW2_479 512
+#define __NEXT_POW2_480 512
+#define __NEXT_POW2_481 512
+#define __NEXT_POW2_482 512
+#define __NEXT_POW2_483 512
+#define __NEXT_POW2_484 512
+#define __NEXT_POW2_485 512
+#define __NEXT_POW2_486 512
+#define __NEXT_POW2_487 512
+#define __NEXT_POW2_488 512
+#define __NEXT_POW2_489 512
+#define __NEXT_POW2_490 512
+#define __NEXT_POW2_491 512
+#define __NEXT_POW2_492 512
+#define __NEXT_POW2_493 512
+#define __NEXT_POW2_494 512
+#define __NEXT_POW2_495 512
+#define __NEXT_POW2_496 512
+#define __NEXT_POW2_497 512
+#define __NEXT_POW2_498 512
+#define __NEXT_POW2_499 512
+#define __NEXT_POW2_500 512
+#define __NEXT_POW2_501 512
+#define __NEXT_POW2_502 512
+#define __NEXT_POW2_503 512
+#define __NEXT_POW2_504 512
+#define __NEXT_POW2_505 512
+#define __NEXT_POW2_506 512
+#define __NEXT_POW2_507 512
+#define __NEXT_POW2_508 512
+#define __NEXT_POW2_509 512
+#define __NEXT_POW2_510 512
+#define __NEXT_POW2_511 512
+
+#endif // !MCMT_ARITH_BITS_TABLE_H
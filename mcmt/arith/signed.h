@@ -0,0 +1,96 @@
+#ifndef MCMT_ARITH_SIGNED_H
+#define MCMT_ARITH_SIGNED_H
+
+#include "../extn_impl_ovld.h"
+#include "../arg.h"
+#include "../bit_logic.h"
+#include "../logic.h"
+#include "../arith.h"
+
+/**********************************
+ * MCMT_ARITH_SIGNED_H
+ * @brief Macros for arithmetic and comparisons on signed numbers.
+ *********************************/
+#pragma region mcmt_arith_signed
+
+/**
+ * @brief Signed numbers in [-MCMT_ARITH_MAX, MCMT_ARITH_MAX], in sign-magnitude form.
+ * @details A non-negative number is written as itself and a negative one as `NEG(magnitude)`, e.g. `NEG(3)` for -3;
+ * zero is always `0`, never `NEG(0)`. `NEG` is not a macro: the preprocessor cannot test for a leading `-` token, but
+ * pasting `NEG(3)` to a prefix gives a macro call, so the `INT_` macros read the sign with one token paste and pass the
+ * magnitudes on to the unsigned macros. `ADD`, `SUB` and the comparisons are unchanged and keep their cost.
+ *
+ * `INT_LITERAL` turns a signed number into a C literal, `-3` for `NEG(3)`, and `INT_RANGE` emits literals.
+ * For example:
+ * @code
+ * INT_ADD(NEG(3), 1)                         // NEG(2)
+ * INT_LITERAL(INT_SUB(2, 5))                 // -3
+ * INT_LESS(NEG(4), NEG(3))                   // 1
+ * static const int offsets[] = { INT_RANGE(NEG(2), 2, 1) }; // { -2, -1, 0, 1, 2 }
+ * @endcode
+ */
+#define INT_LITERAL(_x)       __INT_EXPAND(__INT_LITERAL, (__INT_SPLIT(_x)))
+#define __INT_LITERAL(_s, _m) OPER_IMPL_OVERLOAD_UNARY(INT_LITERAL_, _s)(_m)
+#define __INT_LITERAL_P(_m)   _m
+#define __INT_LITERAL_N(_m)   -_m
+
+/* the sign, P or N, and the magnitude of a signed number, read by pasting it to __INT_SPLIT_ */
+#define __INT_SPLIT(_x)                      __INT_SPLIT_PICK(__INT_SPLIT_##_x, P, _x, ~)
+#define __INT_SPLIT_PICK(...)                __INT_SPLIT_SIGN_MAG(__VA_ARGS__)
+#define __INT_SPLIT_SIGN_MAG(_x, _s, _m, ...) _s, _m
+#define __INT_SPLIT_NEG(_m)                  ~, N, _m
+
+#define __INT_EXPAND(_OP, _Args) _OP _Args
+#define __INT_FLIP_P             N
+#define __INT_FLIP_N             P
+
+/* negate, absolute value */
+#define INT_NEG(_x)         __INT_EXPAND(__INT_NEG, (__INT_SPLIT(_x)))
+#define __INT_NEG(_s, _m)   OPER_IMPL_OVERLOAD_UNARY(INT_NEG_, _s)(_m)
+#define __INT_NEG_P(_m)     BIT_IF(IS_ZERO(_m), 0, NEG(_m))
+#define __INT_NEG_N(_m)     _m
+#define INT_ABS(_x)         __INT_EXPAND(__INT_ABS, (__INT_SPLIT(_x)))
+#define __INT_ABS(_s, _m)   _m
+
+/* add, subtract: the magnitudes are added if the signs agree, otherwise the smaller one is subtracted */
+#define INT_ADD(_a, _b)                 __INT_EXPAND(__INT_ADD, (__INT_SPLIT(_a), __INT_SPLIT(_b)))
+#define __INT_ADD(_sa, _ma, _sb, _mb)   OPER_IMPL_OVERLOAD_BINARY(INT_ADD_, _sa, _sb)(_ma, _mb)
+#define __INT_ADD_PP(_a, _b)            ADD(_a, _b)
+#define __INT_ADD_NN(_a, _b)            NEG(ADD(_a, _b))
+#define __INT_ADD_PN(_a, _b)            __INT_DIFF(_a, _b)
+#define __INT_ADD_NP(_a, _b)            __INT_DIFF(_b, _a)
+#define INT_SUB(_a, _b)                 __INT_EXPAND(__INT_SUB, (__INT_SPLIT(_a), __INT_SPLIT(_b)))
+#define __INT_SUB(_sa, _ma, _sb, _mb)   __INT_ADD(_sa, _ma, __INT_FLIP_##_sb, _mb)
+
+/* the difference _a - _b of two magnitudes */
+#define __INT_DIFF(_a, _b)     BIT_IF_LAZY(LESS(_a, _b))(__INT_DIFF_NEG, SUB)(_a, _b)
+#define __INT_DIFF_NEG(_a, _b) NEG(SUB(_b, _a))
+
+/**
+ * @brief Compares two signed numbers.
+ * @param _a The first number.
+ * @param _b The second number.
+ * @return `LT`, `EQ` or `GT`, like `CMP`.
+ * @details Numbers of different signs are ordered by their signs alone, otherwise their magnitudes are compared with
+ * `CMP`, in reverse for negative numbers, so the comparison expands in constant depth as well.
+ */
+#define INT_CMP(_a, _b)               __INT_EXPAND(__INT_CMP, (__INT_SPLIT(_a), __INT_SPLIT(_b)))
+#define __INT_CMP(_sa, _ma, _sb, _mb) OPER_IMPL_OVERLOAD_BINARY(INT_CMP_, _sa, _sb)(_ma, _mb)
+#define __INT_CMP_PP(_a, _b)          CMP(_a, _b)
+#define __INT_CMP_NN(_a, _b)          CMP(_b, _a)
+#define __INT_CMP_PN(_a, _b)          GT
+#define __INT_CMP_NP(_a, _b)          LT
+
+/* return 1 if the relation holds, otherwise 0 */
+#define INT_LESS(_a, _b)       OPER_IMPL_OVERLOAD_UNARY(LESS_, INT_CMP(_a, _b))
+#define INT_LESS_EQ(_a, _b)    OPER_IMPL_OVERLOAD_UNARY(LESS_EQ_, INT_CMP(_a, _b))
+#define INT_GREATER(_a, _b)    INT_LESS(_b, _a)
+#define INT_GREATER_EQ(_a, _b) INT_LESS_EQ(_b, _a)
+
+#define INT_MIN(_a, _b) BIT_IF(INT_LESS(_b, _a), _b, _a)
+#define INT_MAX(_a, _b) BIT_IF(INT_LESS(_a, _b), _b, _a)
+
+#pragma endregion // mcmt_arith_signed
+/*-------------------------------*/
+
+#endif // !MCMT_ARITH_SIGNED_H
@@ -0,0 +1,887 @@
+#ifndef MCMT_ARITH_TABLE_H
+#define MCMT_ARITH_TABLE_H
+
+/* MCMT_ARITH_TABLES */
+
+/* MCMT_ARITH_TABLE_RANGE: INC is defined on [0, MCMT_ARITH_MAX), DEC and DIGITS on [0, MCMT_ARITH_MAX] */
+#define MCMT_ARITH_MAX 256
+
+/* increase */
+#define __INC_0   1
+#define __INC_1   2
+#define __INC_2   3
+#define __INC_3   4
+#define __INC_4   5
+#define __INC_5   6
+#define __INC_6   7
+#define __INC_7   8
+#define __INC_8   9
+#define __INC_9   10
+#define __INC_10  11
+#define __INC_11  12
+#define __INC_12  13
+#define __INC_13  14
+#define __INC_14  15
+#define __INC_15  16
+#define __INC_16  17
+#define __INC_17  18
+#define __INC_18  19
+#define __INC_19  20
+#define __INC_20  21
+#define __INC_21  22
+#define __INC_22  23
+#define __INC_23  24
+#define __INC_24  25
+#define __INC_25  26
+#define __INC_26  27
+#define __INC_27  28
+#define __INC_28  29
+#define __INC_29  30
+#define __INC_30  31
+#define __INC_31  32
+#define __INC_32  33
+#define __INC_33  34
+#define __INC_34  35
+#define __INC_35  36
+#define __INC_36  37
+#define __INC_37  38
+#define __INC_38  39
+#define __INC_39  40
+#define __INC_40  41
+#define __INC_41  42
+#define __INC_42  43
+#define __INC_43  44
+#define __INC_44  45
+#define __INC_45  46
+#define __INC_46  47
+#define __INC_47  48
+#define __INC_48  49
+#define __INC_49  50
+#define __INC_50  51
+#define __INC_51  52
+#define __INC_52  53
+#define __INC_53  54
+#define __INC_54  55
+#define __INC_55  56
+#define __INC_56  57
+#define __INC_57  58
+#define __INC_58  59
+#define __INC_59  60
+#define __INC_60  61
+#define __INC_61  62
+#define __INC_62  63
+#define __INC_63  64
+#define __INC_64  65
+#define __INC_65  66
+#define __INC_66  67
+#define __INC_67  68
+#define __INC_68  69
+#define __INC_69  70
+#define __INC_70  71
+#define __INC_71  72
+#define __INC_72  73
+#define __INC_73  74
+#define __INC_74  75
+#define __INC_75  76
+#define __INC_76  77
+#define __INC_77  78
+#define __INC_78  79
+#define __INC_79  80
+#define __INC_80  81
+#define __INC_81  82
+#define __INC_82  83
+#define __INC_83  84
+#define __INC_84  85
+#define __INC_85  86
+#define __INC_86  87
+#define __INC_87  88
+#define __INC_88  89
+#define __INC_89  90
+#define __INC_90  91
+#define __INC_91  92
+#define __INC_92  93
+#define __INC_93  94
+#define __INC_94  95
+#define __INC_95  96
+#define __INC_96  97
+#define __INC_97  98
+#define __INC_98  99
+#define __INC_99  100
+#define __INC_100 101
+#define __INC_101 102
+#define __INC_102 103
+#define __INC_103 104
+#define __INC_104 105
+#define __INC_105 106
+#define __INC_106 107
+#define __INC_107 108
+#define __INC_108 109
+#define __INC_109 110
+#define __INC_110 111
+#define __INC_111 112
+#define __INC_112 113
+#define __INC_113 114
+#define __INC_114 115
+#define __INC_115 116
+#define __INC_116 117
+#define __INC_117 118
+#define __INC_118 119
+#define __INC_119 120
+#define __INC_120 121
+#define __INC_121 122
+#define __INC_122 123
+#define __INC_123 124
+#define __INC_124 125
+#define __INC_125 126
+#define __INC_126 127
+#define __INC_127 128
+#define __INC_128 129
+#define __INC_129 130
+#define __INC_130 131
+#define __INC_131 132
+#define __INC_132 133
+#define __INC_133 134
+#define __INC_134 135
+#define __INC_135 136
+#define __INC_136 137
+#define __INC_137 138
+#define __INC_138 139
+#define __INC_139 140
+#define __INC_140 141
+#define __INC_141 142
+#define __INC_142 143
+#define __INC_143 144
+#define __INC_144 145
+#define __INC_145 146
+#define __INC_146 147
+#define __INC_147 148
+#define __INC_148 149
+#define __INC_149 150
+#define __INC_150 151
+#define __INC_151 152
+#define __INC_152 153
+#define __INC_153 154
+#define __INC_154 155
+#define __INC_155 156
+#define __INC_156 157
+#define __INC_157 158
+#define __INC_158 159
+#define __INC_159 160
+#define __INC_160 161
+#define __INC_161 162
+#define __INC_162 163
+#define __INC_163 164
+#define __INC_164 165
+#define __INC_165 166
+#define __INC_166 167
+#define __INC_167 168
+#define __INC_168 169
+#define __INC_169 170
+#define __INC_170 171
+#define __INC_171 172
+#define __INC_172 173
+#define __INC_173 174
+#define __INC_174 175
+#define __INC_175 176
+#define __INC_176 177
+#define __INC_177 178
+#define __INC_178 179
+#define __INC_179 180
+#define __INC_180 181
+#define __INC_181 182
+#define __INC_182 183
+#define __INC_183 184
+#define __INC_184 185
+#define __INC_185 186
+#define __INC_186 187
+#define __INC_187 188
+#define __INC_188 189
+#define __INC_189 190
+#define __INC_190 191
+#define __INC_191 192
+#define __INC_192 193
+#define __INC_193 194
+#define __INC_194 195
+#define __INC_195 196
+#define __INC_196 197
+#define __INC_197 198
+#define __INC_198 199
+#define __INC_199 200
+#define __INC_200 201
+#define __INC_201 202
+#define __INC_202 203
+#define __INC_203 204
+#define __INC_204 205
+#define __INC_205 206
+#define __INC_206 207
+#define __INC_207 208
+#define __INC_208 209
+#define __INC_209 210
+#define __INC_210 211
+#define __INC_211 212
+#define __INC_212 213
+#define __INC_213 214
+#define __INC_214 215
+#define __INC_215 216
+#define __INC_216 217
+#define __INC_217 218
+#define __INC_218 219
+#define __INC_219 220
+#define __INC_220 221
+#define __INC_221 222
+#define __INC_222 223
+#define __INC_223 224
+#define __INC_224 225
+#define __INC_225 226
+#define __INC_226 227
+#define __INC_227 228
+#define __INC_228 229
+#define __INC_229 230
+#define __INC_230 231
+#define __INC_231 232
+#define __INC_232 233
+#define __INC_233 234
+#define __INC_234 235
+#define __INC_235 236
+#define __INC_236 237
+#define __INC_237 238
+#define __INC_238 239
+#define __INC_239 240
+#define __INC_240 241
+#define __INC_241 242
+#define __INC_242 243
+#define __INC_243 244
+#define __INC_244 245
+#define __INC_245 246
+#define __INC_246 247
+#define __INC_247 248
+#define __INC_248 249
+#define __INC_249 250
+#define __INC_250 251
+#define __INC_251 252
+#define __INC_252 253
+#define __INC_253 254
+#define __INC_254 255
+#define __INC_255 256
+
+/* decrease (saturates at 0) */
+#define __DEC_0   0
+#define __DEC_1   0
+#define __DEC_2   1
+#define __DEC_3   2
+#define __DEC_4   3
+#define __DEC_5   4
+#define __DEC_6   5
+#define __DEC_7   6
+#define __DEC_8   7
+#define __DEC_9   8
+#define __DEC_10  9
+#define __DEC_11  10
+#define __DEC_12  11
+#define __DEC_13  12
+#define __DEC_14  13
+#define __DEC_15  14
+#define __DEC_16  15
+#define __DEC_17  16
+#define __DEC_18  17
+#define __DEC_19  18
+#define __DEC_20  19
+#define __DEC_21  20
+#define __DEC_22  21
+#define __DEC_23  22
+#define __DEC_24  23
+#define __DEC_25  24
+#define __DEC_26  25
+#define __DEC_27  26
+#define __DEC_28  27
+#define __DEC_29  28
+#define __DEC_30  29
+#define __DEC_31  30
+#define __DEC_32  31
+#define __DEC_33  32
+#define __DEC_34  33
+#define __DEC_35  34
+#define __DEC_36  35
+#define __DEC_37  36
+#define __DEC_38  37
+#define __DEC_39  38
+#define __DEC_40  39
+#define __DEC_41  40
+#define __DEC_42  41
+#define __DEC_43  42
+#define __DEC_44  43
+#define __DEC_45  44
+#define __DEC_46  45
+#define __DEC_47  46
+#define __DEC_48  47
+#define __DEC_49  48
+#define __DEC_50  49
+#define __DEC_51  50
+#define __DEC_52  51
+#define __DEC_53  52
+#define __DEC_54  53
+#define __DEC_55  54
+#define __DEC_56  55
+#define __DEC_57  56
+#define __DEC_58  57
+#define __DEC_59  58
+#define __DEC_60  59
+#define __DEC_61  60
+#define __DEC_62  61
+#define __DEC_63  62
+#define __DEC_64  63
+#define __DEC_65  64
+#define __DEC_66  65
+#define __DEC_67  66
+#define __DEC_68  67
+#define __DEC_69  68
+#define __DEC_70  69
+#define __DEC_71  70
+#define __DEC_72  71
+#define __DEC_73  72
+#define __DEC_74  73
+#define __DEC_75  74
+#define __DEC_76  75
+#define __DEC_77  76
+#define __DEC_78  77
+#define __DEC_79  78
+#define __DEC_80  79
+#define __DEC_81  80
+#define __DEC_82  81
+#define __DEC_83  82
+#define __DEC_84  83
+#define __DEC_85  84
+#define __DEC_86  85
+#define __DEC_87  86
+#define __DEC_88  87
+#define __DEC_89  88
+#define __DEC_90  89
+#define __DEC_91  90
+#define __DEC_92  91
+#define __DEC_93  92
+#define __DEC_94  93
+#define __DEC_95  94
+#define __DEC_96  95
+#define __DEC_97  96
+#define __DEC_98  97
+#define __DEC_99  98
+#define __DEC_100 99
+#define __DEC_101 100
+#define __DEC_102 101
+#define __DEC_103 102
+#define __DEC_104 103
+#define __DEC_105 104
+#define __DEC_106 105
+#define __DEC_107 106
+#define __DEC_108 107
+#define __DEC_109 108
+#define __DEC_110 109
+#define __DEC_111 110
+#define __DEC_112 111
+#define __DEC_113 112
+#define __DEC_114 113
+#define __DEC_115 114
+#define __DEC_116 115
+#define __DEC_117 116
+#define __DEC_118 117
+#define __DEC_119 118
+#define __DEC_120 119
+#define __DEC_121 120
+#define __DEC_122 121
+#define __DEC_123 122
+#define __DEC_124 123
+#define __DEC_125 124
+#define __DEC_126 125
+#define __DEC_127 126
+#define __DEC_128 127
+#define __DEC_129 128
+#define __DEC_130 129
+#define __DEC_131 130
+#define __DEC_132 131
+#define __DEC_133 132
+#define __DEC_134 133
+#define __DEC_135 134
+#define __DEC_136 135
+#define __DEC_137 136
+#define __DEC_138 137
+#define __DEC_139 138
+#define __DEC_140 139
+#define __DEC_141 140
+#define __DEC_142 141
+#define __DEC_143 142
+#define __DEC_144 143
+#define __DEC_145 144
+#define __DEC_146 145
+#define __DEC_147 146
+#define __DEC_148 147
+#define __DEC_149 148
+#define __DEC_150 149
+#define __DEC_151 150
+#define __DEC_152 151
+#define __DEC_153 152
+#define __DEC_154 153
+#define __DEC_155 154
+#define __DEC_156 155
+#define __DEC_157 156
+#define __DEC_158 157
+#define __DEC_159 158
+#define __DEC_160 159
+#define __DEC_161 160
+#define __DEC_162 161
+#define __DEC_163 162
+#define __DEC_164 163
+#define __DEC_165 164
+#define __DEC_166 165
+#define __DEC_167 166
+#define __DEC_168 167
+#define __DEC_169 168
+#define __DEC_170 169
+#define __DEC_171 170
+#define __DEC_172 171
+#define __DEC_173 172
+#define __DEC_174 173
+#define __DEC_175 174
+#define __DEC_176 175
+#define __DEC_177 176
+#define __DEC_178 177
+#define __DEC_179 178
+#define __DEC_180 179
+#define __DEC_181 180
+#define __DEC_182 181
+#define __DEC_183 182
+#define __DEC_184 183
+#define __DEC_185 184
+#define __DEC_186 185
+#define __DEC_187 186
+#define __DEC_188 187
+#define __DEC_189 188
+#define __DEC_190 189
+#define __DEC_191 190
+#define __DEC_192 191
+#define __DEC_193 192
+#define __DEC_194 193
+#define __DEC_195 194
+#define __DEC_196 195
+#define __DEC_197 196
+#define __DEC_198 197
+#define __DEC_199 198
+#define __DEC_200 199
+#define __DEC_201 200
+#define __DEC_202 201
+#define __DEC_203 202
+#define __DEC_204 203
+#define __DEC_205 204
+#define __DEC_206 205
+#define __DEC_207 206
+#define __DEC_208 207
+#define __DEC_209 208
+#define __DEC_210 209
+#define __DEC_211 210
+#define __DEC_212 211
+#define __DEC_213 212
+#define __DEC_214 213
+#define __DEC_215 214
+#define __DEC_216 215
+#define __DEC_217 216
+#define __DEC_218 217
+#define __DEC_219 218
+#define __DEC_220 219
+#define __DEC_221 220
+#define __DEC_222 221
+#define __DEC_223 222
+#define __DEC_224 223
+#define __DEC_225 224
+#define __DEC_226 225
+#define __DEC_227 226
+#define __DEC_228 227
+#define __DEC_229 228
+#define __DEC_230 229
+#define __DEC_231 230
+#define __DEC_232 231
+#define __DEC_233 232
+#define __DEC_234 233
+#define __DEC_235 234
+#define __DEC_236 235
+#define __DEC_237 236
+#define __DEC_238 237
+#define __DEC_239 238
+#define __DEC_240 239
+#define __DEC_241 240
+#define __DEC_242 241
+#define __DEC_243 242
+#define __DEC_244 243
+#define __DEC_245 244
+#define __DEC_246 245
+#define __DEC_247 246
+#define __DEC_248 247
+#define __DEC_249 248
+#define __DEC_250 249
+#define __DEC_251 250
+#define __DEC_252 251
+#define __DEC_253 252
+#define __DEC_254 253
+#define __DEC_255 254
+#define __DEC_256 255
+
+/* decimal digits (hundreds, tens, ones) */
+#define __DIGITS_0   (0, 0, 0)
+#define __DIGITS_1   (0, 0, 1)
+#define __DIGITS_2   (0, 0, 2)
+#define __DIGITS_3   (0, 0, 3)
+#define __DIGITS_4   (0, 0, 4)
+#define __DIGITS_5   (0, 0, 5)
+#define __DIGITS_6   (0, 0, 6)
+#define __DIGITS_7   (0, 0, 7)
+#define __DIGITS_8   (0, 0, 8)
+#define __DIGITS_9   (0, 0, 9)
+#define __DIGITS_10  (0, 1, 0)
+#define __DIGITS_11  (0, 1, 1)
+#define __DIGITS_12  (0, 1, 2)
+#define __DIGITS_13  (0, 1, 3)
+#define __DIGITS_14  (0, 1, 4)
+#define __DIGITS_15  (0, 1, 5)
+#define __DIGITS_16  (0, 1, 6)
+#define __DIGITS_17  (0, 1, 7)
+#define __DIGITS_18  (0, 1, 8)
+#define __DIGITS_19  (0, 1, 9)
+#define __DIGITS_20  (0, 2, 0)
+#define __DIGITS_21  (0, 2, 1)
+#define __DIGITS_22  (0, 2, 2)
+#define __DIGITS_23  (0, 2, 3)
+#define __DIGITS_24  (0, 2, 4)
+#define __DIGITS_25  (0, 2, 5)
+#define __DIGITS_26  (0, 2, 6)
+#define __DIGITS_27  (0, 2, 7)
+#define __DIGITS_28  (0, 2, 8)
+#define __DIGITS_29  (0, 2, 9)
+#define __DIGITS_30  (0, 3, 0)
+#define __DIGITS_31  (0, 3, 1)
+#define __DIGITS_32  (0, 3, 2)
+#define __DIGITS_33  (0, 3, 3)
+#define __DIGITS_34  (0, 3, 4)
+#define __DIGITS_35  (0, 3, 5)
+#define __DIGITS_36  (0, 3, 6)
+#define __DIGITS_37  (0, 3, 7)
+#define __DIGITS_38  (0, 3, 8)
+#define __DIGITS_39  (0, 3, 9)
+#define __DIGITS_40  (0, 4, 0)
+#define __DIGITS_41  (0, 4, 1)
+#define __DIGITS_42  (0, 4, 2)
+#define __DIGITS_43  (0, 4, 3)
+#define __DIGITS_44  (0, 4, 4)
+#define __DIGITS_45  (0, 4, 5)
+#define __DIGITS_46  (0, 4, 6)
+#define __DIGITS_47  (0, 4, 7)
+#define __DIGITS_48  (0, 4, 8)
+#define __DIGITS_49  (0, 4, 9)
+#define __DIGITS_50  (0, 5, 0)
+#define __DIGITS_51  (0, 5, 1)
+#define __DIGITS_52  (0, 5, 2)
+#define __DIGITS_53  (0, 5, 3)
+#define __DIGITS_54  (0, 5, 4)
+#define __DIGITS_55  (0, 5, 5)
+#define __DIGITS_56  (0, 5, 6)
+#define __DIGITS_57  (0, 5, 7)
+#define __DIGITS_58  (0, 5, 8)
+#define __DIGITS_59  (0, 5, 9)
+#define __DIGITS_60  (0, 6, 0)
+#define __DIGITS_61  (0, 6, 1)
+#define __DIGITS_62  (0, 6, 2)
+#define __DIGITS_63  (0, 6, 3)
+#define __DIGITS_64  (0, 6, 4)
+#define __DIGITS_65  (0, 6, 5)
+#define __DIGITS_66  (0, 6, 6)
+#define __DIGITS_67  (0, 6, 7)
+#define __DIGITS_68  (0, 6, 8)
+#define __DIGITS_69  (0, 6, 9)
+#define __DIGITS_70  (0, 7, 0)
+#define __DIGITS_71  (0, 7, 1)
+#define __DIGITS_72  (0, 7, 2)
+#define __DIGITS_73  (0, 7, 3)
+#define __DIGITS_74  (0, 7, 4)
+#define __DIGITS_75  (0, 7, 5)
+#define __DIGITS_76  (0, 7, 6)
+#define __DIGITS_77  (0, 7, 7)
+#define __DIGITS_78  (0, 7, 8)
+#define __DIGITS_79  (0, 7, 9)
+#define __DIGITS_80  (0, 8, 0)
+#define __DIGITS_81  (0, 8, 1)
+#define __DIGITS_82  (0, 8, 2)
+#define __DIGITS_83  (0, 8, 3)
+#define __DIGITS_84  (0, 8, 4)
+#define __DIGITS_85  (0, 8, 5)
+#define __DIGITS_86  (0, 8, 6)
+#define __DIGITS_87  (0, 8, 7)
+#define __DIGITS_88  (0, 8, 8)
+#define __DIGITS_89  (0, 8, 9)
+#define __DIGITS_90  (0, 9, 0)
+#define __DIGITS_91  (0, 9, 1)
+#define __DIGITS_92  (0, 9, 2)
+#define __DIGITS_93  (0, 9, 3)
+#define __DIGITS_94  (0, 9, 4)
+#define __DIGITS_95  (0, 9, 5)
+#define __DIGITS_96  (0, 9, 6)
+#define __DIGITS_97  (0, 9, 7)
+#define __DIGITS_98  (0, 9, 8)
+#define __DIGITS_99  (0, 9, 9)
+#define __DIGITS_100 (1, 0, 0)
+#define __DIGITS_101 (1, 0, 1)
+#define __DIGITS_102 (1, 0, 2)
+#define __DIGITS_103 (1, 0, 3)
+#define __DIGITS_104 (1, 0, 4)
+#define __DIGITS_105 (1, 0, 5)
+#define __DIGITS_106 (1, 0, 6)
+#define __DIGITS_107 (1, 0, 7)
+#define __DIGITS_108 (1, 0, 8)
+#define __DIGITS_109 (1, 0, 9)
+#define __DIGITS_110 (1, 1, 0)
+#define __DIGITS_111 (1, 1, 1)
+#define __DIGITS_112 (1, 1, 2)
+#define __DIGITS_113 (1, 1, 3)
+#define __DIGITS_114 (1, 1, 4)
+#define __DIGITS_115 (1, 1, 5)
+#define __DIGITS_116 (1, 1, 6)
+#define __DIGITS_117 (1, 1, 7)
+#define __DIGITS_118 (1, 1, 8)
+#define __DIGITS_119 (1, 1, 9)
+#define __DIGITS_120 (1, 2, 0)
+#define __DIGITS_121 (1, 2, 1)
+#define __DIGITS_122 (1, 2, 2)
+#define __DIGITS_123 (1, 2, 3)
+#define __DIGITS_124 (1, 2, 4)
+#define __DIGITS_125 (1, 2, 5)
+#define __DIGITS_126 (1, 2, 6)
+#define __DIGITS_127 (1, 2, 7)
+#define __DIGITS_128 (1, 2, 8)
+#define __DIGITS_129 (1, 2, 9)
+#define __DIGITS_130 (1, 3, 0)
+#define __DIGITS_131 (1, 3, 1)
+#define __DIGITS_132 (1, 3, 2)
+#define __DIGITS_133 (1, 3, 3)
+#define __DIGITS_134 (1, 3, 4)
+#define __DIGITS_135 (1, 3, 5)
+#define __DIGITS_136 (1, 3, 6)
+#define __DIGITS_137 (1, 3, 7)
+#define __DIGITS_138 (1, 3, 8)
+#define __DIGITS_139 (1, 3, 9)
+#define __DIGITS_140 (1, 4, 0)
+#define __DIGITS_141 (1, 4, 1)
+#define __DIGITS_142 (1, 4, 2)
+#define __DIGITS_143 (1, 4, 3)
+#define __DIGITS_144 (1, 4, 4)
+#define __DIGITS_145 (1, 4, 5)
+#define __DIGITS_146 (1, 4, 6)
+#define __DIGITS_147 (1, 4, 7)
+#define __DIGITS_148 (1, 4, 8)
+#define __DIGITS_149 (1, 4, 9)
+#define __DIGITS_150 (1, 5, 0)
+#define __DIGITS_151 (1, 5, 1)
+#define __DIGITS_152 (1, 5, 2)
+#define __DIGITS_153 (1, 5, 3)
+#define __DIGITS_154 (1, 5, 4)
+#define __DIGITS_155 (1, 5, 5)
+#define __DIGITS_156 (1, 5, 6)
+#define __DIGITS_157 (1, 5, 7)
+#define __DIGITS_158 (1, 5, 8)
+#define __DIGITS_159 (1, 5, 9)
+#define __DIGITS_160 (1, 6, 0)
+#define __DIGITS_161 (1, 6, 1)
+#define __DIGITS_162 (1, 6, 2)
+#define __DIGITS_163 (1, 6, 3)
+#define __DIGITS_164 (1, 6, 4)
+#define __DIGITS_165 (1, 6, 5)
+#define __DIGITS_166 (1, 6, 6)
+#define __DIGITS_167 (1, 6, 7)
+#define __DIGITS_168 (1, 6, 8)
+#define __DIGITS_169 (1, 6, 9)
+#define __DIGITS_170 (1, 7, 0)
+#define __DIGITS_171 (1, 7, 1)
+#define __DIGITS_172 (1, 7, 2)
+#define __DIGITS_173 (1, 7, 3)
+#define __DIGITS_174 (1, 7, 4)
+#define __DIGITS_175 (1, 7, 5)
+#define __DIGITS_176 (1, 7, 6)
+#define __DIGITS_177 (1, 7, 7)
+#define __DIGITS_178 (1, 7, 8)
+#define __DIGITS_179 (1, 7, 9)
+#define __DIGITS_180 (1, 8, 0)
+#define __DIGITS_181 (1, 8, 1)
+#define __DIGITS_182 (1, 8, 2)
+#define __DIGITS_183 (1, 8, 3)
+#define __DIGITS_184 (1, 8, 4)
+#define __DIGITS_185 (1, 8, 5)
+#define __DIGITS_186 (1, 8, 6)
+#define __DIGITS_187 (1, 8, 7)
+#define __DIGITS_188 (1, 8, 8)
+#define __DIGITS_189 (1, 8, 9)
+#define __DIGITS_190 (1, 9, 0)
+#define __DIGITS_191 (1, 9, 1)
+#define __DIGITS_192 (1, 9, 2)
+#define __DIGITS_193 (1, 9, 3)
+#define __DIGITS_194 (1, 9, 4)
+#define __DIGITS_195 (1, 9, 5)
+#define __DIGITS_196 (1, 9, 6)
+#define __DIGITS_197 (1, 9, 7)
+#define __DIGITS_198 (1, 9, 8)
+#define __DIGITS_199 (1, 9, 9)
+#define __DIGITS_200 (2, 0, 0)
+#define __DIGITS_201 (2, 0, 1)
+#define __DIGITS_202 (2, 0, 2)
+#define __DIGITS_203 (2, 0, 3)
+#define __DIGITS_204 (2, 0, 4)
+#define __DIGITS_205 (2, 0, 5)
+#define __DIGITS_206 (2, 0, 6)
+#define __DIGITS_207 (2, 0, 7)
+#define __DIGITS_208 (2, 0, 8)
+#define __DIGITS_209 (2, 0, 9)
+#define __DIGITS_210 (2, 1, 0)
+#define __DIGITS_211 (2, 1, 1)
+#define __DIGITS_212 (2, 1, 2)
+#define __DIGITS_213 (2, 1, 3)
+#define __DIGITS_214 (2, 1, 4)
+#define __DIGITS_215 (2, 1, 5)
+#define __DIGITS_216 (2, 1, 6)
+#define __DIGITS_217 (2, 1, 7)
+#define __DIGITS_218 (2, 1, 8)
+#define __DIGITS_219 (2, 1, 9)
+#define __DIGITS_220 (2, 2, 0)
+#define __DIGITS_221 (2, 2, 1)
+#define __DIGITS_222 (2, 2, 2)
+#define __DIGITS_223 (2, 2, 3)
+#define __DIGITS_224 (2, 2, 4)
+#define __DIGITS_225 (2, 2, 5)
+#define __DIGITS_226 (2, 2, 6)
+#define __DIGITS_227 (2, 2, 7)
+#define __DIGITS_228 (2, 2, 8)
+#define __DIGITS_229 (2, 2, 9)
+#define __DIGITS_230 (2, 3, 0)
+#define __DIGITS_231 (2, 3, 1)
+#define __DIGITS_232 (2, 3, 2)
+#define __DIGITS_233 (2, 3, 3)
+#define __DIGITS_234 (2, 3, 4)
+#define __DIGITS_235 (2, 3, 5)
+#define __DIGITS_236 (2, 3, 6)
+#define __DIGITS_237 (2, 3, 7)
+#define __DIGITS_238 (2, 3, 8)
+#define __DIGITS_239 (2, 3, 9)
+#define __DIGITS_240 (2, 4, 0)
+#define __DIGITS_241 (2, 4, 1)
+#define __DIGITS_242 (2, 4, 2)
+#define __DIGITS_243 (2, 4, 3)
+#define __DIGITS_244 (2, 4, 4)
+#define __DIGITS_245 (2, 4, 5)
+#define __DIGITS_246 (2, 4, 6)
+#define __DIGITS_247 (2, 4, 7)
+#define __DIGITS_248 (2, 4, 8)
+#define __DIGITS_249 (2, 4, 9)
+#define __DIGITS_250 (2, 5, 0)
+#define __DIGITS_251 (2, 5, 1)
+#define __DIGITS_252 (2, 5, 2)
+#define __DIGITS_253 (2, 5, 3)
+#define __DIGITS_254 (2, 5, 4)
+#define __DIGITS_255 (2, 5, 5)
+#define __DIGITS_256 (2, 5, 6)
+
+/* digit comparison */
+#define __DIGIT_CMP_00 EQ
+#define __DIGIT_CMP_01 LT
+#define __DIGIT_CMP_02 LT
+#define __DIGIT_CMP_03 LT
+#define __DIGIT_CMP_04 LT
+#define __DIGIT_CMP_05 LT
+#define __DIGIT_CMP_06 LT
+#define __DIGIT_CMP_07 LT
+#define __DIGIT_CMP_08 LT
+#define __DIGIT_CMP_09 LT
+#define __DIGIT_CMP_10 GT
+#define __DIGIT_CMP_11 EQ
+#define __DIGIT_CMP_12 LT
+#define __DIGIT_CMP_13 LT
+#define __DIGIT_CMP_14 LT
+#define __DIGIT_CMP_15 LT
+#define __DIGIT_CMP_16 LT
+#define __DIGIT_CMP_17 LT
+#define __DIGIT_CMP_18 LT
+#define __DIGIT_CMP_19 LT
+#define __DIGIT_CMP_20 GT
+#define __DIGIT_CMP_21 GT
+#define __DIGIT_CMP_22 EQ
+#define __DIGIT_CMP_23 LT
+#define __DIGIT_CMP_24 LT
+#define __DIGIT_CMP_25 LT
+#define __DIGIT_CMP_26 LT
+#define __DIGIT_CMP_27 LT
+#define __DIGIT_CMP_28 LT
+#define __DIGIT_CMP_29 LT
+#define __DIGIT_CMP_30 GT
+#define __DIGIT_CMP_31 GT
+#define __DIGIT_CMP_32 GT
+#define __DIGIT_CMP_33 EQ
+#define __DIGIT_CMP_34 LT
+#define __DIGIT_CMP_35 LT
+#define __DIGIT_CMP_36 LT
+#define __DIGIT_CMP_37 LT
+#define __DIGIT_CMP_38 LT
+#define __DIGIT_CMP_39 LT
+#define __DIGIT_CMP_40 GT
+#define __DIGIT_CMP_41 GT
+#define __DIGIT_CMP_42 GT
+#define __DIGIT_CMP_43 GT
+#define __DIGIT_CMP_44 EQ
+#define __DIGIT_CMP_45 LT
+#define __DIGIT_CMP_46 LT
+#define __DIGIT_CMP_47 LT
+#define __DIGIT_CMP_48 LT
+#define __DIGIT_CMP_49 LT
+#define __DIGIT_CMP_50 GT
+#define __DIGIT_CMP_51 GT
+#define __DIGIT_CMP_52 GT
+#define __DIGIT_CMP_53 GT
+#define __DIGIT_CMP_54 GT
+#define __DIGIT_CMP_55 EQ
+#define __DIGIT_CMP_56 LT
+#define __DIGIT_CMP_57 LT
+#define __DIGIT_CMP_58 LT
+#define __DIGIT_CMP_59 LT
+#define __DIGIT_CMP_60 GT
+#define __DIGIT_CMP_61 GT
+#define __DIGIT_CMP_62 GT
+#define __DIGIT_CMP_63 GT
+#define __DIGIT_CMP_64 GT
+#define __DIGIT_CMP_65 GT
+#define __DIGIT_CMP_66 EQ
+#define __DIGIT_CMP_67 LT
+#define __DIGIT_CMP_68 LT
+#define __DIGIT_CMP_69 LT
+#define __DIGIT_CMP_70 GT
+#define __DIGIT_CMP_71 GT
+#define __DIGIT_CMP_72 GT
+#define __DIGIT_CMP_73 GT
+#define __DIGIT_CMP_74 GT
+#define __DIGIT_CMP_75 GT
+#define __DIGIT_CMP_76 GT
+#define __DIGIT_CMP_77 EQ
+#define __DIGIT_CMP_78 LT
+#define __DIGIT_CMP_79 LT
+#define __DIGIT_CMP_80 GT
+#define __DIGIT_CMP_81 GT
+#define __DIGIT_CMP_82 GT
+#define __DIGIT_CMP_83 GT
+#define __DIGIT_CMP_84 GT
+#define __DIGIT_CMP_85 GT
+#define __DIGIT_CMP_86 GT
+#define __DIGIT_CMP_87 GT
+#define __DIGIT_CMP_88 EQ
+#define __DIGIT_CMP_89 LT
+#define __DIGIT_CMP_90 GT
+#define __DIGIT_CMP_91 GT
+#define __DIGIT_CMP_92 GT
+#define __DIGIT_CMP_93 GT
+#define __DIGIT_CMP_94 GT
+#define __DIGIT_CMP_95 GT
+#define __DIGIT_CMP_96 GT
+#define __DIGIT_CMP_97 GT
+#define __DIGIT_CMP_98 GT
+#define __DIGIT_CMP_99 EQ
+
+#endif // !MCMT_ARITH_TABLE_H
@@ -0,0 +1,50 @@
+#ifndef MCMT_BAKE_H
+#define MCMT_BAKE_H
+
+#include "extn_impl_ovld.h"
+#include "logic.h"
+
+/*********************************
+ * MCMT_BAKE_H
+ * @brief Macros for substituting invocations expanded ahead of time by tools/mcmt_bake.py.
+ *********************************/
+#pragma region mcmt_bake
+
+/**
+ * @brief Expands to the cached expansion of an invocation if it was baked, otherwise to the invocation itself.
+ * @param _Key The name of the entry, an identifier unique in the source file.
+ * @param ... The invocation, e.g. `BINOM(30, 4)`.
+ * @details `tools/mcmt_bake.py` expands every `MCMT_BAKE` of a source file with the local preprocessor and writes a
+ * header that defines, for each key, `__MCMT_BAKED_HIT_<key>` as `PROBE()` and `__MCMT_BAKED_<key>` as the expansion.
+ * When that header is included before the invocation, `MCMT_BAKE` selects the cached expansion by token pasting and
+ * the invocation is never expanded: on GCC, Clang and MSVC it is passed on through `, ## __VA_ARGS__`, which keeps
+ * the argument from being expanded before substitution. Other preprocessors get the same tokens but still expand the
+ * invocation once. A key missing from the header falls back to the invocation, so sources build before the first
+ * bake, and `MCMT_BAKE_DISABLE` turns the cache off.
+ *
+ * The header does not check that an entry still matches its invocation: the tool keys every entry by a hash of the
+ * invocation, of its preceding directives and of the headers of the source, and must run before every build. The
+ * rules of `tools/mcmt_bake.mk` (GNU make) and `tools/mcmt_bake.cmake` (CMake) regenerate the header whenever the
+ * source or one of its headers changes, and `--check` fails a build or CI job on a stale header instead.
+ * For example:
+ * @code
+ * #include "macrometa.h"
+ * #include "table.bake.h" // tools/mcmt_bake.py table.c -- -I.
+ *
+ * static const int subsets = MCMT_BAKE(subsets_30_4, BINOM(30, 4));
+ * @endcode
+ */
+#if defined(MCMT_BAKE_DISABLE)
+#    define MCMT_BAKE(_Key, ...) __VA_ARGS__
+#elif defined(__GNUC__) || defined(_MSC_VER)
+#    define MCMT_BAKE(_Key, ...) OPER_IMPL_OVERLOAD_UNARY(MCMT_BAKE_, IS_PROBE(__MCMT_BAKED_HIT_##_Key))(_Key, ~, ##__VA_ARGS__)
+#else
+#    define MCMT_BAKE(_Key, ...) OPER_IMPL_OVERLOAD_UNARY(MCMT_BAKE_, IS_PROBE(__MCMT_BAKED_HIT_##_Key))(_Key, ~, __VA_ARGS__)
+#endif // defined(MCMT_BAKE_DISABLE)
+#define __MCMT_BAKE_0(_Key, _Unused, ...) __VA_ARGS__
+#define __MCMT_BAKE_1(_Key, _Unused, ...) __MCMT_BAKED_##_Key
+
+#pragma endregion // mcmt_bake
+/*-------------------------------*/
+
+#endif // !MCMT_BAKE_H
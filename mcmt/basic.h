@@ -0,0 +1,48 @@
+#ifndef MCMT_BASIC_H
+#define MCMT_BASIC_H
+
+/**********************************
+ * MCMT_BASIC_H
+ * @brief Macros for Basic Metaprogramming Operations.
+ *********************************/
+#pragma region mcmt_basic
+
+/**
+ * @brief Expands to nothing.
+ */
+#define EMPTY()
+
+/**
+ * @brief Removes arguments.
+ * @param ... Arguments to be removed.
+ */
+#define IGNORE(...)
+
+/**
+ * @brief Expands arguments.
+ * @param ... Arguments to be expanded.
+ */
+#define EXPAND(...)       EXPAND_LIMIT(__VA_ARGS__)
+#define EXPAND0(...)      __VA_ARGS__
+#define EXPAND1(...)      EXPAND0(__VA_ARGS__)
+#define EXPAND2(...)      EXPAND1(EXPAND1(__VA_ARGS__))
+#define EXPAND3(...)      EXPAND2(EXPAND2(__VA_ARGS__))
+#define EXPAND4(...)      EXPAND3(EXPAND3(__VA_ARGS__))
+#define EXPAND5(...)      EXPAND4(EXPAND4(__VA_ARGS__))
+#define EXPAND6(...)      EXPAND5(EXPAND5(__VA_ARGS__))
+#define EXPAND7(...)      EXPAND6(EXPAND6(__VA_ARGS__))
+#define EXPAND_LIMIT(...) EXPAND7(EXPAND7(__VA_ARGS__))
+
+/**
+ * @brief Expands to a comma.
+ */
+#define COMMA(...) ,
+
+#define ENCLOSE(...)        (__VA_ARGS__)
+#define UNCLOSE_UNEVAL(...) __VA_ARGS__
+#define UNCLOSE(...)        UNCLOSE_UNEVAL __VA_ARGS__
+
+#pragma endregion // mcmt_basic
+/*-------------------------------*/
+
+#endif // !MCMT_BASIC_H
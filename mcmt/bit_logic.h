@@ -0,0 +1,66 @@
+#ifndef MCMT_BIT_LOGIC_H
+#define MCMT_BIT_LOGIC_H
+
+#include "extn_impl_ovld.h"
+
+/*********************************
+ * MCMT_BIT_LOGIC_H
+ *********************************/
+#pragma region mcmt_bit_logic
+
+/* bit logic */
+#define BIT_TRUE(...)  1
+#define BIT_FALSE(...) 0
+
+#define BIT_CMPL(_bit)      OPER_IMPL_OVERLOAD_UNARY_UNEVAL(BIT_CMPL_, _bit)
+#define __BIT_CMPL_0        1
+#define __BIT_CMPL_1        0
+#define BIT_NOT(_bit)       OPER_IMPL_OVERLOAD_UNARY_UNEVAL(BIT_NOT_, _bit)
+#define __BIT_NOT_0         1
+#define __BIT_NOT_1         0
+#define BIT_AND(_p, _q)     OPER_IMPL_OVERLOAD_BINARY_UNEVAL(BIT_AND_, _p, _q)
+#define __BIT_AND_00        0
+#define __BIT_AND_01        0
+#define __BIT_AND_10        0
+#define __BIT_AND_11        1
+#define BIT_OR(_p, _q)      OPER_IMPL_OVERLOAD_BINARY_UNEVAL(BIT_OR_, _p, _q)
+#define __BIT_OR_00         0
+#define __BIT_OR_01         1
+#define __BIT_OR_10         1
+#define __BIT_OR_11         1
+#define BIT_XOR(_p, _q)     OPER_IMPL_OVERLOAD_BINARY_UNEVAL(BIT_XOR_, _p, _q)
+#define __BIT_XOR_00        0
+#define __BIT_XOR_01        1
+#define __BIT_XOR_10        1
+#define __BIT_XOR_11        0
+#define BIT_BOOL_EQ(_p, _q) OPER_IMPL_OVERLOAD_BINARY_UNEVAL(BIT_BOOL_EQ_, _p, _q)
+#define __BIT_BOOL_EQ_00    1
+#define __BIT_BOOL_EQ_01    0
+#define __BIT_BOOL_EQ_10    0
+#define __BIT_BOOL_EQ_11    1
+
+/* if-statement: falseClause is optional */
+#define BIT_IF(_condBit, _trueClause, ...)     OPER_IMPL_OVERLOAD_UNARY_UNEVAL(BIT_IF_, _condBit)(_trueClause, __VA_ARGS__)
+#define __BIT_IF_0(trueClause, ...)            __VA_ARGS__
+#define __BIT_IF_1(_trueClause, ...)           _trueClause
+#define BIT_IF_NOT(_condBit, _trueClause, ...) OPER_IMPL_OVERLOAD_UNARY_UNEVAL(BIT_IF_NOT_, _condBit)(_trueClause, __VA_ARGS__)
+#define __BIT_IF_NOT_0(_trueClause, ...)       _trueClause
+#define __BIT_IF_NOT_1(trueClause, ...)        __VA_ARGS__
+
+/**
+ * @brief Lazy if-statement: `BIT_IF_LAZY(_condBit)(_TRUE, _FALSE)(...)`.
+ * @param _condBit The condition, 0 or 1.
+ * @details Both clauses are macro names, and only the selected one is called with the arguments that follow.
+ * The clauses of `BIT_IF` are macro-expanded as arguments before one of them is picked, so the work of the discarded
+ * clause is done anyway; here the discarded macro is never called. The call also happens after the selection has
+ * finished expanding, so the selected macro may itself use `BIT_IF_LAZY`.
+ * For example, `BIT_IF_LAZY(1)(DEC, MUL)(4)` results in `3` without expanding `MUL`.
+ */
+#define BIT_IF_LAZY(_condBit)          OPER_IMPL_OVERLOAD_UNARY_UNEVAL(BIT_IF_LAZY_, _condBit)
+#define __BIT_IF_LAZY_0(_TRUE, _FALSE) _FALSE
+#define __BIT_IF_LAZY_1(_TRUE, _FALSE) _TRUE
+
+#pragma endregion // mcmt_bit_logic
+/*-------------------------------*/
+
+#endif // !MCMT_BIT_LOGIC_H
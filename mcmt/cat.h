@@ -0,0 +1,30 @@
+#ifndef MCMT_CAT_H
+#define MCMT_CAT_H
+
+#include "basic.h"
+#include "concat.h"
+
+/**********************************
+ * MCMT_CAT_H
+ * @brief Macros for complex identifier concatenation and deferring macro calls.
+ *********************************/
+#pragma region mcmt_cat
+
+/* complex concatenate */
+#define CAT(_X, _Y)  EXPAND_CAT_WITH(GET_CAT_EXP(_X, _Y))
+#define CAT_(_X, _Y) EXPAND_CAT_WITH(GET_CAT_EXP(_X, CONCAT(_, _Y)))
+
+/* different flavors of CAT */
+#define CAT_WITH(_X, EXPANDED, _METHOD, _Y) CAT_WITH_##_METHOD(_X, _Y)
+#define CAT_WITH_ENCLOSED(_X, _Y)           _X _Y
+#define CAT_WITH_DEFAULT(_X, _Y)            _X##_Y
+
+/* defer call to CAT_WITH until args are evaluated */
+#define ENCLOSE_EXPAND(...) EXPANDED, ENCLOSED, (__VA_ARGS__))IGNORE(
+#define GET_CAT_EXP(_X, _Y)  (_X, ENCLOSE_EXPAND _Y, DEFAULT, _Y)
+#define EXPAND_CAT_WITH(...) CAT_WITH __VA_ARGS__
+
+#pragma endregion // mcmt_cat
+/*-------------------------------*/
+
+#endif // !MCMT_CAT_H
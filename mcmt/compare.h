@@ -0,0 +1,45 @@
+#ifndef MCMT_COMPARE_H
+#define MCMT_COMPARE_H
+
+#include "basic.h"
+#include "cat.h"
+#include "bit_logic.h"
+#include "logic.h"
+#include "tuple.h"
+#include "token/compare.h"
+
+/*********************************
+ * MCMT_COMPARE_H
+ *********************************/
+#pragma region mcmt_compare
+
+// TODO(DevDasae): Consider applying other CATs
+#define NOT_COMPARABLE(_p, _q)                   \
+    IS_ENCLOSED(                                 \
+        CAT_(COMPARE, _p)(CAT_(COMPARE, _q))(()) \
+    )
+
+#define IS_COMPARABLE(_p)     \
+    IS_ENCLOSED(              \
+        CAT_(COMPARE, _p)(()) \
+    )
+
+/*
+ * The 'NOT_EQUALS' operation requires a 'COMPARE_{arg}(_x) _x' macro function for each argument. ex) COMPARE_foo(_x) _x, COMPARE_bar(_x) _x
+ */
+#define NOT_EQUALS(_p, _q)                            \
+    IF(BIT_AND(IS_COMPARABLE(_p), IS_COMPARABLE(_q))) \
+    (                                                 \
+        NOT_COMPARABLE,                               \
+        1 IGNORE                                      \
+    )(_p, _q)
+
+/*
+ * The 'EQUALS' operation requires a 'COMPARE_{arg}(_x) _x' macro function for each argument. ex) COMPARE_foo(_x) _x, COMPARE_bar(_x) _x
+ */
+#define EQUALS(_p, _q) BIT_CMPL(NOT_EQUALS(_p, _q))
+
+#pragma endregion // mcmt_compare
+/*-------------------------------*/
+
+#endif // !MCMT_COMPARE_H
@@ -0,0 +1,50 @@
+#ifndef MCMT_CONCAT_H
+#define MCMT_CONCAT_H
+
+/**********************************
+ * MCMT_CONCAT_H
+ * @brief Macros for concatenating and manipulating identifiers.
+ **********************************/
+#pragma region mcmt_concat
+
+/**
+ * @brief Concatenate two tokens.
+ * @param _X First token.
+ * @param _Y Second token.
+ * @return Concatenation of the two tokens.
+ */
+#define CONCAT(_X, _Y) CONCAT_UNEVAL(_X, _Y)
+
+/**
+ * @brief Concatenate three tokens.
+ * @param _X First token.
+ * @param _Y Second token.
+ * @param _Z Third token.
+ * @return Concatenation of the three tokens.
+ */
+#define CONCAT3(_X, _Y, _Z)         CONCAT3_UNEVAL(_X, _Y, _Z)
+#define CONCAT4(_X, _Y, _Z, _W)     CONCAT4_UNEVAL(_X, _Y, _Z, _W)
+#define CONCAT5(_X, _Y, _Z, _W, _V) CONCAT5_UNEVAL(_X, _Y, _Z, _W, _V)
+#define CONCAT_VA(_Arg, ...)        CONCAT_VA_UNEVAL(_Arg, __VA_ARGS__)
+
+#define PRIM_CONCAT(_X, _Y) _X##_Y
+#if defined(_MSC_VER)
+#    define CONCAT_RETURN(EXPANDED, _XY)       _XY
+#    define CONCAT_UNEVAL(_X, _Y)              CONCAT_RETURN(~, _X##_Y)
+#    define CONCAT3_UNEVAL(_X, _Y, _Z)         CONCAT_RETURN(~, _X##_Y##_Z)
+#    define CONCAT4_UNEVAL(_X, _Y, _Z, _W)     CONCAT_RETURN(~, _X##_Y##_Z##_W)
+#    define CONCAT5_UNEVAL(_X, _Y, _Z, _W, _V) CONCAT_RETURN(~, _X##_Y##_Z##_W##_V)
+#    define CONCAT_VA_RETURN(EXPANDED, ...)    __VA_ARGS__
+#    define CONCAT_VA_UNEVAL(_Arg, ...)        CONCAT_VA_RETURN(~, _Arg##__VA_ARGS__)
+#else // !MSVC workarounds
+#    define CONCAT_UNEVAL(_X, _Y)              _X##_Y
+#    define CONCAT3_UNEVAL(_X, _Y, _Z)         _X##_Y##_Z
+#    define CONCAT4_UNEVAL(_X, _Y, _Z, _W)     _X##_Y##_Z##_W
+#    define CONCAT5_UNEVAL(_X, _Y, _Z, _W, _V) _X##_Y##_Z##_W##_V
+#    define CONCAT_VA_UNEVAL(_Arg, ...)        _Arg##__VA_ARGS__
+#endif // defined(_MSC_VER)
+
+#pragma endregion // mcmt_concat
+/*-------------------------------*/
+
+#endif // !MCMT_CONCAT_H
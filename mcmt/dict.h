@@ -0,0 +1,82 @@
+#ifndef MCMT_DICT_H
+#define MCMT_DICT_H
+
+#include "arg.h"
+#include "concat.h"
+#include "logic.h"
+
+/*********************************
+ * MCMT_DICT_H
+ * @brief Macros for looking up keys in dictionaries and sets of macros, in constant time.
+ *********************************/
+#pragma region mcmt_dict
+
+/**
+ * @brief The definition of a dictionary entry: `#define <_Dict>_<_key> DICT_VALUE(value)`.
+ * @param ... The value, which may contain commas.
+ * @details A macro cannot define another one, so the entries of a dictionary are plain definitions named after the
+ * dictionary and the key, joined by `_`, and `DICT_GET` finds an entry by pasting these two tokens. The key is an
+ * identifier or a number, or a macro expanding to one, which is expanded before the paste. The value expands to
+ * `PROBE(), (value)`, so an entry is also a member of the set of the keys of the dictionary (see `SET_CONTAINS`).
+ * For example:
+ * @code
+ * #define Color_red   DICT_VALUE(0xff0000)
+ * #define Color_green DICT_VALUE(0x00ff00)
+ *
+ * int red = DICT_GET(Color, red, 0);      // int red = 0xff0000;
+ * int blue = DICT_GET(Color, blue, 0);    // int blue = 0;
+ * int known = DICT_CONTAINS(Color, red);  // int known = 1;
+ * @endcode
+ */
+#define DICT_VALUE(...) PROBE(), (__VA_ARGS__)
+
+/**
+ * @brief Expands to the value of a key in a dictionary, or to a default value if the dictionary has no such key.
+ * @param _Dict The name of the dictionary.
+ * @param _key The key, an identifier or a number, or a macro expanding to one.
+ * @param ... The default value.
+ * @details The lookup is a single token paste, whatever the size of the dictionary: when `<_Dict>_<_key>` is defined
+ * with `DICT_VALUE`, it shifts its value into the third argument, otherwise the default value stays there.
+ */
+#define DICT_GET(_Dict, _key, ...)           __DICT_GET(CONCAT3(_Dict, _, _key), ~, (__VA_ARGS__), ~)
+#define __DICT_GET(...)                      __DICT_GET_PICK(__VA_ARGS__)
+#define __DICT_GET_PICK(_x, _y, _value, ...) __DICT_UNCLOSE _value
+#define __DICT_UNCLOSE(...)                  __VA_ARGS__
+
+/**
+ * @brief Checks whether a dictionary has a key.
+ * @param _Dict The name of the dictionary.
+ * @param _key The key, an identifier or a number, or a macro expanding to one.
+ * @details Returns `1` if `<_Dict>_<_key>` is defined with `DICT_VALUE`, `0` otherwise.
+ */
+#define DICT_CONTAINS(_Dict, _key) SET_CONTAINS(_Dict, _key)
+
+/**
+ * @brief The definition of a set member: `#define <_Set>_<_key> SET_MEMBER()`.
+ * @details Expands to `PROBE()`. For example:
+ * @code
+ * #define Features_simd    SET_MEMBER()
+ * #define Features_threads SET_MEMBER()
+ *
+ * #if SET_CONTAINS(Features, simd)
+ * ...
+ * #endif
+ * @endcode
+ */
+#define SET_MEMBER() PROBE()
+
+/**
+ * @brief Checks whether a set has a member.
+ * @param _Set The name of the set.
+ * @param _key The member, an identifier or a number, or a macro expanding to one.
+ * @details Returns `1` if `<_Set>_<_key>` is defined with `SET_MEMBER` (or `DICT_VALUE`), `0` otherwise. Like
+ * `DICT_GET`, it takes a single token paste and the test of `IS_PROBE`, where testing the elements of a list with
+ * `EQUALS` takes a `FOR_EACH` over the list and a `COMPARE_<token>` macro per token.
+ */
+#define SET_CONTAINS(_Set, _key) __SET_CONTAINS(CONCAT3(_Set, _, _key), 0, ~)
+#define __SET_CONTAINS(...)      SND(__VA_ARGS__)
+
+#pragma endregion // mcmt_dict
+/*-------------------------------*/
+
+#endif // !MCMT_DICT_H
@@ -0,0 +1,68 @@
+#ifndef MCMT_EXTN_IMPL_OVLD_H
+#define MCMT_EXTN_IMPL_OVLD_H
+
+#include "concat.h"
+#include "arg.h"
+
+/**********************************
+ * MCMT_EXTN_IMPL_OVLD_H
+ * @brief Macros for extending, implementing, and overloading generic macros
+ *********************************/
+#pragma region mcmt_extn_impl_ovld
+
+#define MACRO_EXTN(_MCR, _EXTS)                               MACRO_EXTN_UNEVAL(_MCR, _EXTS)
+#define MACRO_IMPL(_MCR)                                      MACRO_IMPL_UNEVAL(_MCR)
+#define MACRO_IMPL_OVERLOAD(_MCR_Suffixed)                    MACRO_IMPL_OVERLOAD_UNEVAL(_MCR_Suffixed)
+#define MACRO_IMPL_OVERLOAD_UNARY(_MCR_Suffixed, _OVLS)       MACRO_IMPL_OVERLOAD_UNARY_UNEVAL(_MCR_Suffixed, _OVLS)
+#define MACRO_IMPL_OVERLOAD_BINARY(_MCR_Suffixed, _OVLS, _OP) MACRO_IMPL_OVERLOAD_BINARY_UNEVAL(_MCR_Suffixed, _OVLS, _OP)
+#define OPER_EXTN(_OP, _EXTS)                                 OPER_EXTN_UNEVAL(_OP, _EXTS)
+#define OPER_IMPL(_OP)                                        OPER_IMPL_UNEVAL(_OP)
+#define OPER_IMPL_OVERLOAD(_OP_Suffixed)                      OPER_IMPL_OVERLOAD_UNEVAL(_OP_Suffixed)
+#define OPER_IMPL_OVERLOAD_UNARY(_OP_Suffixed, _operand)      OPER_IMPL_OVERLOAD_UNARY_UNEVAL(_OP_Suffixed, _operand)
+#define OPER_IMPL_OVERLOAD_BINARY(_OP_Suffixed, _lhs, _rhs)   OPER_IMPL_OVERLOAD_BINARY_UNEVAL(_OP_Suffixed, _lhs, _rhs)
+
+#if defined(_MSC_VER)
+#    define MACRO_EXTN_UNEVAL(_MCR, _EXTS)                               CONCAT_RETURN(~, _MCR##_##_EXTS)
+#    define MACRO_IMPL_UNEVAL(_MCR)                                      CONCAT_RETURN(~, __##_MCR)
+#    define MACRO_IMPL_OVERLOAD_UNEVAL(_MCR_Suffixed)                    CONCAT_RETURN(~, __##_MCR_Suffixed)
+#    define MACRO_IMPL_OVERLOAD_UNARY_UNEVAL(_MCR_Suffixed, _OVLS)       CONCAT_RETURN(~, __##_MCR_Suffixed##_OVLS)
+#    define MACRO_IMPL_OVERLOAD_BINARY_UNEVAL(_MCR_Suffixed, _OVLS, _OP) CONCAT_RETURN(~, __##_MCR_Suffixed##_##_OVLS##_##_OP)
+#    define OPER_EXTN_UNEVAL(_OP, _EXTS)                                 CONCAT_RETURN(~, _OP##_##_EXTS)
+#    define OPER_IMPL_UNEVAL(_OP)                                        CONCAT_RETURN(~, __##_OP)
+#    define OPER_IMPL_OVERLOAD_UNEVAL(_OP_Suffixed)                      CONCAT_RETURN(~, __##_OP_Suffixed)
+#    define OPER_IMPL_OVERLOAD_UNARY_UNEVAL(_OP_Suffixed, _operand)      CONCAT_RETURN(~, __##_OP_Suffixed##_operand)
+#    define OPER_IMPL_OVERLOAD_BINARY_UNEVAL(_OP_Suffixed, _lhs, _rhs)   CONCAT_RETURN(~, __##_OP_Suffixed##_lhs##_rhs)
+#else // !MSVC workarounds
+#    define MACRO_EXTN_UNEVAL(_MCR, _EXTS)                               _MCR##_##_EXTS
+#    define MACRO_IMPL_UNEVAL(_MCR)                                      __##_MCR
+#    define MACRO_IMPL_OVERLOAD_UNEVAL(_MCR_Suffixed)                    __##_MCR_Suffixed
+#    define MACRO_IMPL_OVERLOAD_UNARY_UNEVAL(_MCR_Suffixed, _OVLS)       __##_MCR_Suffixed##_OVLS
+#    define MACRO_IMPL_OVERLOAD_BINARY_UNEVAL(_MCR_Suffixed, _OVLS, _OP) __##_MCR_Suffixed##_##_OVLS##_##_OP
+#    define OPER_EXTN_UNEVAL(_OP, _EXTS)                                 _OP##_##_EXTS
+#    define OPER_IMPL_UNEVAL(_OP)                                        __##_OP
+#    define OPER_IMPL_OVERLOAD_UNEVAL(_OP_Suffixed)                      __##_OP_Suffixed
+#    define OPER_IMPL_OVERLOAD_UNARY_UNEVAL(_OP_Suffixed, _operand)      __##_OP_Suffixed##_operand
+#    define OPER_IMPL_OVERLOAD_BINARY_UNEVAL(_OP_Suffixed, _lhs, _rhs)   __##_OP_Suffixed##_lhs##_rhs
+#endif // defined(_MSC_VER)
+
+/**
+ * @brief Calls the overload of a macro (or function) selected by the number of arguments.
+ * @param _NAME The name of the overload set.
+ * @param ... The arguments.
+ * @return `_NAME_<arity>(...)`.
+ * @details The arity is counted with `COUNT_OPT`, so an empty argument list resolves to `_NAME_0()`, and calls with
+ * up to 9 arguments do not expand the 128-entry `COUNT_INV_SEQ_N`.
+ * For example:
+ * @code
+ * #define vec_0()           vec_make(0, 0)
+ * #define vec_1(_s)         vec_make(_s, _s)
+ * #define vec_2(_x, _y)     vec_make(_x, _y)
+ * #define vec(...)          OVERLOAD(vec, __VA_ARGS__)
+ * @endcode
+ */
+#define OVERLOAD(_NAME, ...) CONCAT3(_NAME, _, COUNT_OPT(__VA_ARGS__))(__VA_ARGS__)
+
+#pragma endregion // mcmt_extn_impl_ovld
+/*-------------------------------*/
+
+#endif // !MCMT_EXTN_IMPL_OVLD_H
@@ -0,0 +1,203 @@
+#ifndef MCMT_FOR_EACH_H
+#define MCMT_FOR_EACH_H
+
+#include "extn_impl_ovld.h"
+#include "arg.h"
+#include "recur.h"
+#include "bit_logic.h"
+#include "logic.h"
+#include "list.h"
+#include "tuple.h"
+#include "arith.h"
+#include "arith/bits.h"
+#include "limit.h"
+
+/*********************************
+ * MCMT_FOR_EACH_H
+ *********************************/
+#pragma region mcmt_for_each
+
+// TODO(DevDasae): Refactor this parts
+/* the longest list the EVAL tower completes, each element taking two of its scans (see MCMT_LIMIT_EXCEEDED) */
+#define MCMT_FOR_EACH_MAX 384
+/* EVAL for a list of at most MCMT_FOR_EACH_MAX elements, whose element past the limit is one of the empty slots,
+   otherwise the sentinel naming _Name without running the recursion */
+#define __FOR_EACH_EVAL(_Name, ...)  BIT_IF_LAZY(__FOR_EACH_FITS(__VA_ARGS__))(EVAL, __FOR_EACH_EXCEEDED_##_Name)
+#define __FOR_EACH_FITS(...)         IS_EMPTY(__FOR_EACH_PICK_UNEVAL(__VA_ARGS__, __FOR_EACH_SLOTS()))
+#define __FOR_EACH_PICK_UNEVAL(...) __FOR_EACH_PICK(__VA_ARGS__)
+#define __FOR_EACH_PICK(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, _86, _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100, _101, _102, _103, _104, _105, _106, _107, _108, _109, _110, _111, _112, _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124, _125, _126, _127, _128, _129, _130, _131, _132, _133, _134, _135, _136, _137, _138, _139, _140, _141, _142, _143, _144, _145, _146, _147, _148, _149, _150, _151, _152, _153, _154, _155, _156, _157, _158, _159, _160, _161, _162, _163, _164, _165, _166, _167, _168, _169, _170, _171, _172, _173, _174, _175, _176, _177, _178, _179, _180, _181, _182, _183, _184, _185, _186, _187, _188, _189, _190, _191, _192, _193, _194, _195, _196, _197, _198, _199, _200, _201, _202, _203, _204, _205, _206, _207, _208, _209, _210, _211, _212, _213, _214, _215, _216, _217, _218, _219, _220, _221, _222, _223, _224, _225, _226, _227, _228, _229, _230, _231, _232, _233, _234, _235, _236, _237, _238, _239, _240, _241, _242, _243, _244, _245, _246, _247, _248, _249, _250, _251, _252, _253, _254, _255, _256, _257, _258, _259, _260, _261, _262, _263, _264, _265, _266, _267, _268, _269, _270, _271, _272, _273, _274, _275, _276, _277, _278, _279, _280, _281, _282, _283, _284, _285, _286, _287, _288, _289, _290, _291, _292, _293, _294, _295, _296, _297, _298, _299, _300, _301, _302, _303, _304, _305, _306, _307, _308, _309, _310, _311, _312, _313, _314, _315, _316, _317, _318, _319, _320, _321, _322, _323, _324, _325, _326, _327, _328, _329, _330, _331, _332, _333, _334, _335, _336, _337, _338, _339, _340, _341, _342, _343, _344, _345, _346, _347, _348, _349, _350, _351, _352, _353, _354, _355, _356, _357, _358, _359, _360, _361, _362, _363, _364, _365, _366, _367, _368, _369, _370, _371, _372, _373, _374, _375, _376, _377, _378, _379, _380, _381, _382, _383, _384, _N, ...) _N
+#define __FOR_EACH_SLOTS() ,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,,
+#define __FOR_EACH_EXCEEDED_FOR_EACH(...)       MCMT_LIMIT_EXCEEDED(FOR_EACH, "mcmt: FOR_EACH exceeds MCMT_FOR_EACH_MAX (384) elements")
+#define __FOR_EACH_EXCEEDED_FOR_EACH_WITH(...)  MCMT_LIMIT_EXCEEDED(FOR_EACH, "mcmt: FOR_EACH_WITH exceeds MCMT_FOR_EACH_MAX (384) elements")
+#define __FOR_EACH_EXCEEDED_FOR_EACH_SEP(...)   MCMT_LIMIT_EXCEEDED(FOR_EACH, "mcmt: FOR_EACH_SEP exceeds MCMT_FOR_EACH_MAX (384) elements")
+#define __FOR_EACH_EXCEEDED_FOR_EACH_I(...)     MCMT_LIMIT_EXCEEDED(FOR_EACH, "mcmt: FOR_EACH_I exceeds MCMT_FOR_EACH_MAX (384) elements")
+#define __FOR_EACH_EXCEEDED_FOR_EACH_SLICE(...) MCMT_LIMIT_EXCEEDED(FOR_EACH, "mcmt: FOR_EACH_SLICE exceeds MCMT_FOR_EACH_MAX (384) elements")
+#define __FOR_EACH_EXCEEDED_FOR_EACH_2D(...)    MCMT_LIMIT_EXCEEDED(FOR_EACH, "mcmt: FOR_EACH_2D exceeds MCMT_FOR_EACH_MAX (384) elements")
+#define __FOR_EACH_EXCEEDED_FOR_EACH_3D(...)    MCMT_LIMIT_EXCEEDED(FOR_EACH, "mcmt: FOR_EACH_3D exceeds MCMT_FOR_EACH_MAX (384) elements")
+/* the elements of a list fitting the EVAL budget, counted up to 256 and past 256, the most columns of as many rows
+   of a 2D list, and the most rows of as many columns: each row takes the scans of one element more, so that
+   _Rows * (_Cols + 1) <= MCMT_FOR_EACH_MAX + 1 (capped at 256 too) */
+#define __FOR_EACH_COUNT(...) __FOR_EACH_PICK_UNEVAL(__VA_ARGS__, __FOR_EACH_COUNT_SEQ())
+#define __FOR_EACH_OVER(...)  __FOR_EACH_PICK_UNEVAL(__VA_ARGS__, __FOR_EACH_OVER_SEQ())
+#define __FOR_EACH_COLS(...)  __FOR_EACH_PICK_UNEVAL(__VA_ARGS__, __FOR_EACH_COLS_SEQ())
+#define __FOR_EACH_ROWS(...)  __FOR_EACH_PICK_UNEVAL(__VA_ARGS__, __FOR_EACH_ROWS_SEQ())
+#define __FOR_EACH_COUNT_SEQ() 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240, 239, 238, 237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 227, 226, 225, 224, 223, 222, 221, 220, 219, 218, 217, 216, 215, 214, 213, 212, 211, 210, 209, 208, 207, 206, 205, 204, 203, 202, 201, 200, 199, 198, 197, 196, 195, 194, 193, 192, 191, 190, 189, 188, 187, 186, 185, 184, 183, 182, 181, 180, 179, 178, 177, 176, 175, 174, 173, 172, 171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, 160, 159, 158, 157, 156, 155, 154, 153, 152, 151, 150, 149, 148, 147, 146, 145, 144, 143, 142, 141, 140, 139, 138, 137, 136, 135, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+#define __FOR_EACH_OVER_SEQ()  128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+#define __FOR_EACH_COLS_SEQ()  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 9, 9, 9, 10, 10, 10, 11, 11, 11, 12, 12, 13, 13, 14, 15, 15, 16, 17, 18, 19, 20, 21, 23, 24, 26, 28, 31, 34, 37, 41, 47, 54, 63, 76, 95, 127, 191, 256
+#define __FOR_EACH_ROWS_SEQ()  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 10, 10, 10, 11, 11, 11, 12, 12, 12, 13, 13, 14, 14, 15, 16, 16, 17, 18, 19, 20, 21, 22, 24, 25, 27, 29, 32, 35, 38, 42, 48, 55, 64, 77, 96, 128, 192
+
+/* 1D */
+#define FOR_EACH(_OP, ...) __FOR_EACH_EVAL(FOR_EACH, __VA_ARGS__)(FOR_EACH_UNEVAL(_OP, __VA_ARGS__))
+#define FOR_EACH_UNEVAL(_OP, ...)                                                                                \
+    MCMT_TRACE_STEP(1, FOR_EACH_UNEVAL, _OP, __VA_ARGS__)                                                        \
+    IF(IS_NOT_EMPTY(__VA_ARGS__))                                                                                \
+    (                                                                                                            \
+        DEFER(_OP)(UNCLOSE_OPT(LIST_HEAD(__VA_ARGS__))) DEFER2(FOR_EACH_INDIRECT)()(_OP, LIST_TAIL(__VA_ARGS__)) \
+    )
+#define FOR_EACH_INDIRECT() FOR_EACH_UNEVAL
+
+/* 1D, passing a fixed context argument before each element: _OP(_Ctx, element) */
+#define FOR_EACH_WITH(_OP, _Ctx, ...) __FOR_EACH_EVAL(FOR_EACH_WITH, __VA_ARGS__)(FOR_EACH_WITH_UNEVAL(_OP, _Ctx, __VA_ARGS__))
+#define FOR_EACH_WITH_UNEVAL(_OP, _Ctx, ...)                                                                                      \
+    IF(IS_NOT_EMPTY(__VA_ARGS__))                                                                                                 \
+    (                                                                                                                             \
+        DEFER(_OP)(_Ctx, UNCLOSE_OPT(LIST_HEAD(__VA_ARGS__))) DEFER2(FOR_EACH_WITH_INDIRECT)()(_OP, _Ctx, LIST_TAIL(__VA_ARGS__)) \
+    )
+#define FOR_EACH_WITH_INDIRECT() FOR_EACH_WITH_UNEVAL
+
+/* 1D, emitting _SEP() between two elements: _OP(x1) _SEP() _OP(x2) ..., e.g. with SEP_COMMA from token/sep.h */
+#define FOR_EACH_SEP(_OP, _SEP, ...) __FOR_EACH_EVAL(FOR_EACH_SEP, __VA_ARGS__)(FOR_EACH_SEP_UNEVAL(_OP, _SEP, __VA_ARGS__))
+#define FOR_EACH_SEP_UNEVAL(_OP, _SEP, ...)                                                                                  \
+    IF(IS_NOT_EMPTY(__VA_ARGS__))                                                                                            \
+    (                                                                                                                        \
+        DEFER(_OP)(UNCLOSE_OPT(LIST_HEAD(__VA_ARGS__))) DEFER2(__FOR_EACH_SEP_INDIRECT)()(_OP, _SEP, LIST_TAIL(__VA_ARGS__)) \
+    )
+#define __FOR_EACH_SEP(_OP, _SEP, ...)                                                                                                     \
+    IF(IS_NOT_EMPTY(__VA_ARGS__))                                                                                                          \
+    (                                                                                                                                      \
+        DEFER(_SEP)() DEFER(_OP)(UNCLOSE_OPT(LIST_HEAD(__VA_ARGS__))) DEFER2(__FOR_EACH_SEP_INDIRECT)()(_OP, _SEP, LIST_TAIL(__VA_ARGS__)) \
+    )
+#define __FOR_EACH_SEP_INDIRECT() __FOR_EACH_SEP
+
+/* 1D, passing the zero-based index of each element: _OP(0, x0) _OP(1, x1) ..., indices are limited by the INC table */
+#define FOR_EACH_I(_OP, ...) __FOR_EACH_EVAL(FOR_EACH_I, __VA_ARGS__)(FOR_EACH_I_UNEVAL(_OP, 0, __VA_ARGS__))
+#define FOR_EACH_I_UNEVAL(_OP, _i, ...)                                                                                         \
+    IF(IS_NOT_EMPTY(__VA_ARGS__))                                                                                               \
+    (                                                                                                                           \
+        DEFER(_OP)(_i, UNCLOSE_OPT(LIST_HEAD(__VA_ARGS__))) DEFER2(FOR_EACH_I_INDIRECT)()(_OP, INC(_i), LIST_TAIL(__VA_ARGS__)) \
+    )
+#define FOR_EACH_I_INDIRECT() FOR_EACH_I_UNEVAL
+
+/* 1D, expanding only the _k-th (zero-based) of _M contiguous chunks of ceil(count / _M) elements each;
+   expanding every _k from 0 to _M - 1 in turn produces the same tokens as FOR_EACH, for as many elements;
+   _M of 0 produces MCMT_LIMIT_EXCEEDED_DIV_BY_ZERO */
+#define FOR_EACH_SLICE(_k, _M, _OP, ...) \
+    __FOR_EACH_SLICE_EVAL(_M, __VA_ARGS__)(OPER_IMPL_OVERLOAD_UNARY(FOR_EACH_SLICE_ONE_, IS_ONE(_M))(_OP, _k, _M, __VA_ARGS__))
+/* a single chunk is the whole list, whose count may be past the arithmetic */
+#define __FOR_EACH_SLICE_ONE_1(_OP, _k, _M, ...) IF_LAZY(IS_ZERO(_k))(FOR_EACH_UNEVAL, IGNORE)(_OP, __VA_ARGS__)
+#define __FOR_EACH_SLICE_ONE_0(_OP, _k, _M, ...) \
+    __FOR_EACH_SLICE_START(_OP, _k, __FOR_EACH_SLICE_SIZE(__FOR_EACH_OVER(__VA_ARGS__), __FOR_EACH_COUNT(__VA_ARGS__), _M), __VA_ARGS__)
+#define __FOR_EACH_SLICE_START(_OP, _k, _size, ...)  __FOR_EACH_SLICE(_OP, _k, _size, _size, __VA_ARGS__)
+#define __FOR_EACH_SLICE(_OP, _k, _left, _size, ...) \
+    OPER_IMPL_OVERLOAD_BINARY(FOR_EACH_SLICE_, IS_EMPTY(__VA_ARGS__), IS_ZERO(_k))(_OP, _k, _left, _size, __VA_ARGS__)
+/* skip the elements of the chunks before _k, _left counts down the elements left in the current chunk */
+#define __FOR_EACH_SLICE_00(_OP, _k, _left, _size, ...)                                                               \
+    DEFER(__FOR_EACH_SLICE_INDIRECT)()(                                                                               \
+        _OP, BIT_IF_LAZY(IS_ZERO(DEC(_left)))(__FOR_EACH_SLICE_NEXT, __FOR_EACH_SLICE_STAY)(_k, _left, _size), _size, \
+        LIST_TAIL(__VA_ARGS__)                                                                                        \
+    )
+/* the next (_k, _left) once the current chunk is complete, or while it is not */
+#define __FOR_EACH_SLICE_NEXT(_k, _left, _size) DEC(_k), _size
+#define __FOR_EACH_SLICE_STAY(_k, _left, _size) _k, DEC(_left)
+/* expand the elements of chunk _k, and drop the rest of the list once it is complete */
+#define __FOR_EACH_SLICE_01(_OP, _k, _left, _size, ...)                                             \
+    DEFER(_OP)(UNCLOSE_OPT(LIST_HEAD(__VA_ARGS__))) DEFER(__FOR_EACH_SLICE_INDIRECT)()(             \
+        _OP, 0, DEC(_left), _size,                                                                  \
+        OPER_IMPL_OVERLOAD_UNARY(FOR_EACH_SLICE_REST_, IS_ZERO(DEC(_left)))(LIST_TAIL(__VA_ARGS__)) \
+    )
+#define __FOR_EACH_SLICE_10(_OP, _k, _left, _size, ...)
+#define __FOR_EACH_SLICE_11(_OP, _k, _left, _size, ...)
+#define __FOR_EACH_SLICE_REST_0(...) __VA_ARGS__
+#define __FOR_EACH_SLICE_REST_1(...)
+#define __FOR_EACH_SLICE_INDIRECT()  __FOR_EACH_SLICE
+/* EVAL for a list fitting the budget, in at least one chunk */
+#define __FOR_EACH_SLICE_EVAL(_M, ...) \
+    BIT_IF_LAZY(__FOR_EACH_FITS(__VA_ARGS__))(__FOR_EACH_SLICE_EVAL_CHUNKS, __FOR_EACH_SLICE_EXCEEDED)(_M)
+#define __FOR_EACH_SLICE_EVAL_CHUNKS(_M) BIT_IF_LAZY(IS_ZERO(_M))(__FOR_EACH_SLICE_NO_CHUNK, EVAL)
+#define __FOR_EACH_SLICE_EXCEEDED(_M)    __FOR_EACH_EXCEEDED_FOR_EACH_SLICE
+#define __FOR_EACH_SLICE_NO_CHUNK(...)   MCMT_LIMIT_EXCEEDED(DIV_BY_ZERO, "mcmt: FOR_EACH_SLICE into 0 chunks")
+/* ceil((_Hi + _Lo) / _M) for _M of 2 or more, counting the elements down one by one, first the (up to 256) of _Lo,
+   then the rest of _Hi, while _m counts down the elements left in the current chunk: a step is a table lookup, where
+   subtracting _M would run a tower of its own */
+#define __FOR_EACH_SLICE_SIZE(_Hi, _Lo, _M) \
+    __FOR_EACH_SLICE_SIZE_HI(_Hi, _M, ARITH_L1_EVAL(__FOR_EACH_SLICE_SIZE_UNEVAL(_Lo, 0, _M, 0)))
+#define __FOR_EACH_SLICE_SIZE_HI(...)                  __FOR_EACH_SLICE_SIZE_HI_UNEVAL(__VA_ARGS__)
+#define __FOR_EACH_SLICE_SIZE_HI_UNEVAL(_Hi, _M, _m, _size) \
+    __FOR_EACH_SLICE_SIZE_LAST(ARITH_L1_EVAL(__FOR_EACH_SLICE_SIZE_UNEVAL(_Hi, _m, _M, _size)))
+#define __FOR_EACH_SLICE_SIZE_LAST(...)                __FOR_EACH_SLICE_SIZE_LAST_UNEVAL(__VA_ARGS__)
+#define __FOR_EACH_SLICE_SIZE_LAST_UNEVAL(_m, _size)   _size
+#define __FOR_EACH_SLICE_SIZE_UNEVAL(_N, _m, _M, _size) \
+    IF_LAZY(IS_NOT_ZERO(_N))(__FOR_EACH_SLICE_SIZE_STEP, __FOR_EACH_SLICE_SIZE_DONE)(_N, _m, _M, _size)
+#define __FOR_EACH_SLICE_SIZE_STEP(_N, _m, _M, _size)                                                          \
+    DEFER(__FOR_EACH_SLICE_SIZE_INDIRECT)()(                                                                   \
+        DEC(_N), BIT_IF_LAZY(IS_ZERO(_m))(__FOR_EACH_SLICE_SIZE_NEW, __FOR_EACH_SLICE_SIZE_OLD)(_m, _M, _size) \
+    )
+/* the element starts a new chunk, or is one more of the current one */
+#define __FOR_EACH_SLICE_SIZE_NEW(_m, _M, _size)       DEC(_M), _M, INC(_size)
+#define __FOR_EACH_SLICE_SIZE_OLD(_m, _M, _size)       DEC(_m), _M, _size
+#define __FOR_EACH_SLICE_SIZE_DONE(_N, _m, _M, _size)  _m, _size
+#define __FOR_EACH_SLICE_SIZE_INDIRECT()               __FOR_EACH_SLICE_SIZE_UNEVAL
+
+/* 2D */
+#define FOR_EACH_2D(_OP, _List1, _List2)        __FOR_EACH_2D_EVAL(_List1, _List2)(FOR_EACH_2D_UNEVAL(_OP, _List1, _List2))
+#define FOR_EACH_2D_UNEVAL(_OP, _List1, _List2) __FOR_EACH_2D(_OP, _List1, _List1, _List2, _List2)
+#define __FOR_EACH_2D(_OP, _List1, _OriginList1, _List2, _OriginList2)                                                                 \
+    IF(IS_NOT_EMPTY _List2)                                                                                                            \
+    (                                                                                                                                  \
+        _OP(LIST_HEAD _List1, LIST_HEAD _List2) DEFER2(FOR_EACH_2D_INDIRECT)()(_OP, _List1, _List1, (LIST_TAIL _List2), _OriginList2), \
+        IF(IS_NOT_EMPTY(LIST_TAIL _List1))(                                                                                            \
+            DEFER3(FOR_EACH_2D_INDIRECT)()(_OP, (LIST_TAIL _OriginList1), (LIST_TAIL _OriginList1), _OriginList2, _OriginList2)        \
+        )                                                                                                                              \
+    )
+#define FOR_EACH_2D_INDIRECT() __FOR_EACH_2D
+/* EVAL for _List1 rows of _List2 columns fitting the budget, checked once both lists fit it */
+#define __FOR_EACH_2D_EVAL(_List1, _List2) \
+    BIT_IF_LAZY(BIT_AND(__FOR_EACH_FITS _List1, __FOR_EACH_FITS _List2))(__FOR_EACH_2D_EVAL_AREA, __FOR_EACH_2D_EXCEEDED)(_List1, _List2)
+#define __FOR_EACH_2D_EVAL_AREA(_List1, _List2) BIT_IF_LAZY(__FOR_EACH_2D_FITS(_List1, _List2))(EVAL, __FOR_EACH_EXCEEDED_FOR_EACH_2D)
+#define __FOR_EACH_2D_EXCEEDED(_List1, _List2)  __FOR_EACH_EXCEEDED_FOR_EACH_2D
+#define __FOR_EACH_2D_FITS(_List1, _List2)      LESS_EQ(__FOR_EACH_COUNT _List2, __FOR_EACH_COLS _List1)
+
+/* 3D */
+#define FOR_EACH_3D(_OP, _List1, _List2, _List3)        __FOR_EACH_3D_EVAL(_List1, _List2, _List3)(FOR_EACH_3D_UNEVAL(_OP, _List1, _List2, _List3))
+#define FOR_EACH_3D_UNEVAL(_OP, _List1, _List2, _List3) __FOR_EACH_3D_UNEVAL(_OP, _List1, _List1, _List2, _List2, _List3, _List3)
+#define __FOR_EACH_3D_UNEVAL(_OP, _List1, _OriginList1, _List2, _OriginList2, _List3, _OriginList3)                                                                      \
+    IF(IS_NOT_EMPTY _List3)                                                                                                                                              \
+    (                                                                                                                                                                    \
+        _OP(LIST_HEAD _List1, LIST_HEAD _List2, LIST_HEAD _List3) DEFER2(FOR_EACH_3D_INDIRECT)()(_OP, _List1, _List1, _List2, _List2, (LIST_TAIL _List3), _OriginList3), \
+        IF(IS_NOT_EMPTY(LIST_TAIL _List2))(                                                                                                                              \
+            DEFER3(FOR_EACH_3D_INDIRECT)()(_OP, _OriginList1, _OriginList1, (LIST_TAIL _OriginList2), (LIST_TAIL _OriginList2), _OriginList3, _OriginList3)              \
+                IF(IS_NOT_EMPTY(LIST_TAIL _List1))(                                                                                                                      \
+                    DEFER4(FOR_EACH_3D_INDIRECT)()(                                                                                                                      \
+                        _OP, (LIST_TAIL _OriginList1), (LIST_TAIL _OriginList1), _OriginList2, _OriginList2, _OriginList3, _OriginList3                                  \
+                    )                                                                                                                                                    \
+                )                                                                                                                                                        \
+        )                                                                                                                                                                \
+    )
+#define FOR_EACH_3D_INDIRECT() __FOR_EACH_3D_UNEVAL
+/* EVAL for _List1 * _List2 rows of _List3 columns fitting the budget of as many rows of a 2D list, which is more
+   than they take, checked once the three lists fit it */
+#define __FOR_EACH_3D_EVAL(_List1, _List2, _List3)                                                        \
+    BIT_IF_LAZY(BIT_AND(BIT_AND(__FOR_EACH_FITS _List1, __FOR_EACH_FITS _List2), __FOR_EACH_FITS _List3)) \
+    (__FOR_EACH_3D_EVAL_AREA, __FOR_EACH_3D_EXCEEDED)(_List1, _List2, _List3)
+#define __FOR_EACH_3D_EVAL_AREA(_List1, _List2, _List3) \
+    BIT_IF_LAZY(__FOR_EACH_3D_FITS(_List1, _List2, _List3))(EVAL, __FOR_EACH_EXCEEDED_FOR_EACH_3D)
+#define __FOR_EACH_3D_EXCEEDED(_List1, _List2, _List3) __FOR_EACH_EXCEEDED_FOR_EACH_3D
+/* _List2 within the rows of _List3 columns, divided by the count of _List1 rounded up to a power of two so the
+   division is a shift: exact for 1, 2, 4, ... elements of _List1, at most twice too strict otherwise */
+#define __FOR_EACH_3D_FITS(_List1, _List2, _List3) \
+    LESS_EQ(__FOR_EACH_COUNT _List2, SHR(__FOR_EACH_ROWS _List3, LOG2(NEXT_POW2(__FOR_EACH_COUNT _List1))))
+
+#pragma endregion // mcmt_for_each
+/*-------------------------------*/
+
+#endif // !MCMT_FOR_EACH_H
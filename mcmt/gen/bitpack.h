@@ -0,0 +1,125 @@
+#ifndef MCMT_GEN_BITPACK_H
+#define MCMT_GEN_BITPACK_H
+
+#include <stdint.h>
+
+#include "../basic.h"
+#include "../concat.h"
+#include "../arg.h"
+#include "../recur.h"
+#include "../logic.h"
+#include "../list.h"
+#include "../for_each.h"
+#include "../arith.h"
+#include "../token/sep.h"
+
+/**********************************
+ * MCMT_GEN_BITPACK_H
+ * @brief Macros for generating bit-packed records in a 64-bit word.
+ *********************************/
+#pragma region mcmt_gen_bitpack
+
+/**
+ * @brief Mask of the `_width` low bits of a 64-bit word.
+ * @param _width The number of bits, in [1, 64].
+ */
+#define BITPACK_MASK(_width) (UINT64_MAX >> (64 - (_width)))
+
+/**
+ * @brief Generates a record packed into a 64-bit word from a list of bit fields.
+ * @param _Name The name of the record type.
+ * @param ... The fields, each enclosed as `(width, field)`. The first field occupies the lowest bits.
+ * @details The offset of each field is the running `ADD` of the preceding widths, so it is computed once per field
+ * while the fields are walked into enumeration constants, and every accessor shifts and masks by those constants:
+ * - `_Name`: the packed word (`uint64_t`).
+ * - `_Name_<field>_OFFSET`, `_Name_<field>_WIDTH`: enumeration constants describing the field.
+ * - `_Name_get_<field>(v)`: extracts the field from `v`.
+ * - `_Name_set_<field>(v, x)`: returns `v` with the field replaced by the low bits of `x`.
+ * - `_Name_make(fields...)`: packs all fields, in declaration order.
+ *
+ * A static assertion rejects layouts whose widths add up to more than 64 bits.
+ * For example:
+ * @code
+ * BITPACK(Key, (12, tenant), (10, shard), (42, seq))
+ *
+ * Key k = Key_make(7, 3, 123456);
+ * k     = Key_set_seq(k, Key_get_seq(k) + 1);
+ * // Key_get_shard(k) == ((k >> 12) & 0x3FF)
+ * @endcode
+ */
+#define BITPACK(_Name, ...)                                       \
+    __BITPACK_TYPES(_Name, __VA_ARGS__)                           \
+    FOR_EACH_WITH(__BITPACK_ACCESSORS_STATIC, _Name, __VA_ARGS__) \
+    __BITPACK_MAKE(static inline, _Name, __VA_ARGS__)
+
+/**
+ * @brief Generates a packed record, its field constants and the prototypes of its accessors.
+ * @param _Name The name of the record type.
+ * @param ... The fields, each enclosed as `(width, field)`.
+ * @details The header form of `BITPACK`; `BITPACK_DEFINE` with the same arguments emits the accessors in one source file.
+ * The `_OFFSET` and `_WIDTH` constants stay in the header, so code that extracts fields by hand is not slowed down.
+ */
+#define BITPACK_DECLARE(_Name, ...)                              \
+    __BITPACK_TYPES(_Name, __VA_ARGS__)                          \
+    FOR_EACH_WITH(__BITPACK_ACCESSORS_PROTO, _Name, __VA_ARGS__) \
+    _Name CONCAT(_Name, _make)(FOR_EACH_SEP(__BITPACK_PARAM, SEP_COMMA, __VA_ARGS__));
+
+/**
+ * @brief Generates the accessors of a packed record declared by `BITPACK_DECLARE`, with external linkage.
+ * @param _Name The name of the record type.
+ * @param ... The fields, each enclosed as `(width, field)`.
+ */
+#define BITPACK_DEFINE(_Name, ...)                                \
+    FOR_EACH_WITH(__BITPACK_ACCESSORS_EXTERN, _Name, __VA_ARGS__) \
+    __BITPACK_MAKE(, _Name, __VA_ARGS__)
+
+#define __BITPACK_TYPES(_Name, ...)                                                                                             \
+    typedef uint64_t _Name;                                                                                                     \
+    _Static_assert(FOR_EACH_SEP(__BITPACK_WIDTH, SEP_PLUS, __VA_ARGS__) <= 64, "BITPACK: fields of " #_Name " exceed 64 bits"); \
+    EVAL(__BITPACK_FIELDS(_Name, 0, __VA_ARGS__))
+#define __BITPACK_MAKE(_Link, _Name, ...)                                                     \
+    _Link _Name CONCAT(_Name, _make)(FOR_EACH_SEP(__BITPACK_PARAM, SEP_COMMA, __VA_ARGS__)) { \
+        _Name v = 0;                                                                          \
+        FOR_EACH_WITH(__BITPACK_MAKE_FIELD, _Name, __VA_ARGS__)                               \
+        return v;                                                                             \
+    }
+
+#define __BITPACK_WIDTH(_width, _field)             (_width)
+#define __BITPACK_PARAM(_width, _field)             uint64_t _field
+#define __BITPACK_MAKE_FIELD(_Name, _width, _field) v = CONCAT3(_Name, _set_, _field)(v, _field);
+
+/* walk the fields, carrying the offset of the current one */
+#define __BITPACK_FIELDS(_Name, _offset, ...)                                                                    \
+    IF(IS_NOT_EMPTY(__VA_ARGS__))                                                                                \
+    (                                                                                                            \
+        __BITPACK_FIELD_EXPAND(__BITPACK_FIELD, (_Name, _offset, UNCLOSE(LIST_HEAD(__VA_ARGS__))))               \
+            DEFER2(__BITPACK_FIELDS_INDIRECT)()(                                                                 \
+                _Name, ADD(_offset, __BITPACK_FIELD_EXPAND(FST, LIST_HEAD(__VA_ARGS__))), LIST_TAIL(__VA_ARGS__) \
+            )                                                                                                    \
+    )
+#define __BITPACK_FIELDS_INDIRECT()             __BITPACK_FIELDS
+#define __BITPACK_FIELD_EXPAND(_OP, _Args)      _OP _Args
+#define __BITPACK_FIELD(_Name, _offset, _width, _field) \
+    enum {                                              \
+        CONCAT4(_Name, _, _field, _OFFSET) = _offset,   \
+        CONCAT4(_Name, _, _field, _WIDTH)  = _width     \
+    };
+
+/* the accessors read the shift and the width back from the constants emitted by the walk above */
+#define __BITPACK_ACCESSORS_STATIC(_Name, _width, _field) __BITPACK_ACCESSORS(static inline, _Name, CONCAT4(_Name, _, _field, _OFFSET), _width, _field)
+#define __BITPACK_ACCESSORS_EXTERN(_Name, _width, _field) __BITPACK_ACCESSORS(, _Name, CONCAT4(_Name, _, _field, _OFFSET), _width, _field)
+#define __BITPACK_ACCESSORS_PROTO(_Name, _width, _field) \
+    uint64_t CONCAT3(_Name, _get_, _field)(_Name v);     \
+    _Name    CONCAT3(_Name, _set_, _field)(_Name v, uint64_t x);
+#define __BITPACK_ACCESSORS(_Link, _Name, _offset, _width, _field)                                 \
+    _Link uint64_t CONCAT3(_Name, _get_, _field)(_Name v) {                                        \
+        return (v >> _offset) & BITPACK_MASK(_width);                                              \
+    }                                                                                              \
+    _Link _Name CONCAT3(_Name, _set_, _field)(_Name v, uint64_t x) {                               \
+        return (v & ~(BITPACK_MASK(_width) << _offset)) | ((x & BITPACK_MASK(_width)) << _offset); \
+    }
+
+#pragma endregion // mcmt_gen_bitpack
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_BITPACK_H
@@ -0,0 +1,112 @@
+#ifndef MCMT_GEN_DISPATCH_H
+#define MCMT_GEN_DISPATCH_H
+
+#include "../arg.h"
+#include "../concat.h"
+#include "../for_each.h"
+
+/**********************************
+ * MCMT_GEN_DISPATCH_H
+ * @brief Macros for generating threaded (computed-goto) dispatch for interpreter loops.
+ *********************************/
+#pragma region mcmt_gen_dispatch
+
+/**
+ * @brief Generates the opcode enumeration of an interpreter.
+ * @param _prefix The prefix of the generated names.
+ * @param ... The opcodes.
+ * @details Emits `_prefix_<op>` for each opcode, numbered from 0 in declaration order, followed by `_prefix_COUNT`.
+ * Use it at file scope with the same opcode list as `DISPATCH_TABLE`, typically through a list macro:
+ * @code
+ * #define VM_OPS PUSH, ADD, JMP, HALT
+ * DISPATCH_OPCODES(vm, VM_OPS)
+ * @endcode
+ */
+#define DISPATCH_OPCODES(_prefix, ...)                         \
+    enum {                                                     \
+        FOR_EACH_WITH(__DISPATCH_OPCODE, _prefix, __VA_ARGS__) \
+            CONCAT(_prefix, _COUNT)                            \
+    }
+
+/**
+ * @brief Dispatch with GCC/Clang labels as values unless `MCMT_DISPATCH_NO_COMPUTED_GOTO` is defined.
+ * @details Without `__GNUC__`, or with `MCMT_DISPATCH_NO_COMPUTED_GOTO` defined, the same source compiles to
+ * a `switch` whose handlers jump back to it, so an interpreter written with these macros stays portable.
+ */
+#if defined(__GNUC__) && !defined(MCMT_DISPATCH_NO_COMPUTED_GOTO)
+#    define MCMT_DISPATCH_COMPUTED_GOTO 1
+#else
+#    define MCMT_DISPATCH_COMPUTED_GOTO 0
+#endif // defined(__GNUC__) && !defined(MCMT_DISPATCH_NO_COMPUTED_GOTO)
+
+/**
+ * @brief Generates the dispatch table of an interpreter function.
+ * @param _prefix The prefix given to `DISPATCH_OPCODES`.
+ * @param ... The opcodes, in any order, each once.
+ * @details Place it among the declarations of the interpreter function. With computed goto, it emits the
+ * `static` array `_prefix_dispatch` of the addresses of the per-op labels `_prefix_label_<op>`, placed with designated
+ * initializers at their opcode, followed by the address of `DISPATCH_DEFAULT`; a static assertion rejects a list whose
+ * number of opcodes differs from `_prefix_COUNT`. The handlers are then laid out with `DISPATCH_CASE` between
+ * `DISPATCH_START` and `DISPATCH_END`, and each handler ends with `DISPATCH_NEXT`, which jumps straight to the handler
+ * of the next opcode, or to the handler of `DISPATCH_DEFAULT`, which every interpreter must have, for an opcode
+ * outside the list. `DISPATCH_NEXT` is a jump in both forms, so it may also be used inside a loop of a handler.
+ * For example:
+ * @code
+ * int run(const unsigned char* ip) {
+ *     DISPATCH_TABLE(vm, VM_OPS);
+ *     int acc = 0;
+ *     DISPATCH_START(vm, *ip++)
+ *     DISPATCH_CASE(vm, PUSH) acc = *ip++;  DISPATCH_NEXT(vm, *ip++);
+ *     DISPATCH_CASE(vm, ADD)  acc += *ip++; DISPATCH_NEXT(vm, *ip++);
+ *     DISPATCH_CASE(vm, JMP)  ip += *ip;    DISPATCH_NEXT(vm, *ip++);
+ *     DISPATCH_CASE(vm, HALT) return acc;
+ *     DISPATCH_DEFAULT(vm)    return -1;
+ *     DISPATCH_END(vm)
+ * }
+ * @endcode
+ */
+#if MCMT_DISPATCH_COMPUTED_GOTO
+#    define DISPATCH_TABLE(_prefix, ...)                                                                \
+        _Static_assert(COUNT(__VA_ARGS__) == CONCAT(_prefix, _COUNT),                                   \
+                       "DISPATCH_TABLE: " #_prefix " must list every opcode of DISPATCH_OPCODES once"); \
+        static void* const CONCAT(_prefix, _dispatch)[CONCAT(_prefix, _COUNT) + 1] = {                  \
+            FOR_EACH_WITH(__DISPATCH_LABEL_ADDRESS, _prefix, __VA_ARGS__)                               \
+            [CONCAT(_prefix, _COUNT)] = &&CONCAT(_prefix, _dispatch_default) };                         \
+        unsigned CONCAT(_prefix, _dispatch_op)
+#    define DISPATCH_START(_prefix, _opcode) DISPATCH_NEXT(_prefix, _opcode);
+#    define DISPATCH_CASE(_prefix, _op)      CONCAT3(_prefix, _label_, _op) :
+#    define DISPATCH_DEFAULT(_prefix)        CONCAT(_prefix, _dispatch_default) :
+#    define DISPATCH_NEXT(_prefix, _opcode)                                                                    \
+        goto* CONCAT(_prefix, _dispatch)[(CONCAT(_prefix, _dispatch_op) = (_opcode)) < CONCAT(_prefix, _COUNT) \
+                                             ? CONCAT(_prefix, _dispatch_op)                                   \
+                                             : CONCAT(_prefix, _COUNT)]
+#    define DISPATCH_END(_prefix)
+#else // !MCMT_DISPATCH_COMPUTED_GOTO
+#    define DISPATCH_TABLE(_prefix, ...)                                                                \
+        _Static_assert(COUNT(__VA_ARGS__) == CONCAT(_prefix, _COUNT),                                   \
+                       "DISPATCH_TABLE: " #_prefix " must list every opcode of DISPATCH_OPCODES once"); \
+        unsigned CONCAT(_prefix, _dispatch_op)
+#    define DISPATCH_START(_prefix, _opcode)       \
+        CONCAT(_prefix, _dispatch_op) = (_opcode); \
+        CONCAT(_prefix, _dispatch_top) :           \
+        switch (CONCAT(_prefix, _dispatch_op)) {
+#    define DISPATCH_CASE(_prefix, _op)     case CONCAT3(_prefix, _, _op):
+#    define DISPATCH_DEFAULT(_prefix)       default: CONCAT(_prefix, _dispatch_default):
+#    define DISPATCH_NEXT(_prefix, _opcode)            \
+        do {                                           \
+            CONCAT(_prefix, _dispatch_op) = (_opcode); \
+            goto CONCAT(_prefix, _dispatch_top);       \
+        } while (0)
+/* the jump never taken makes DISPATCH_DEFAULT as required as with computed goto */
+#    define DISPATCH_END(_prefix) \
+        }                         \
+        if (0) goto CONCAT(_prefix, _dispatch_default);
+#endif // MCMT_DISPATCH_COMPUTED_GOTO
+
+#define __DISPATCH_OPCODE(_prefix, _op)        CONCAT3(_prefix, _, _op),
+#define __DISPATCH_LABEL_ADDRESS(_prefix, _op) [CONCAT3(_prefix, _, _op)] = &&CONCAT3(_prefix, _label_, _op),
+
+#pragma endregion // mcmt_gen_dispatch
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_DISPATCH_H
@@ -0,0 +1,97 @@
+#ifndef MCMT_GEN_ENUM_H
+#define MCMT_GEN_ENUM_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include "../pp.h"
+#include "../concat.h"
+#include "../arg.h"
+#include "../for_each.h"
+
+/**********************************
+ * MCMT_GEN_ENUM_H
+ * @brief Macros for generating enumerations with compile-time reflection tables.
+ *********************************/
+#pragma region mcmt_gen_enum
+
+/**
+ * @brief Generates an enumeration together with its name tables and string conversions.
+ * @param _Name The name of the enumeration type.
+ * @param ... The enumerators.
+ * @details This macro emits the following for the enumeration `_Name`:
+ * - `_Name`: the enumeration, whose enumerators are numbered densely from 0 with `FOR_EACH_I`.
+ * - `_Name_COUNT`: the number of enumerators.
+ * - `_Name_names`, `_Name_name_lens`: the name and the name length of each enumerator, indexed by its value.
+ * - `_Name_to_string(v)`: returns the name of `v` in O(1), or `NULL` when `v` is out of range.
+ * - `_Name_from_string(s, len, out)`: stores the enumerator named by the `len` characters at `s` into `*out`
+ *   and returns 1, or returns 0 when there is none.
+ *
+ * All tables are emitted as constants, so nothing is built at startup, and marked `MCMT_MAYBE_UNUSED`. The
+ * preprocessor cannot measure the length of a token, so `_Name_from_string` is unrolled into one test per enumerator
+ * against `sizeof("name") - 1` and `"name"[0]`, which the compiler folds into immediate compares on the length and the
+ * first character; `memcmp` with a constant size only runs for the candidate that passes both.
+ * For example:
+ * @code
+ * REFLECT_ENUM(Method, GET, PUT, POST, DELETE)
+ *
+ * Method m;
+ * if (Method_from_string("POST", 4, &m)) { puts(Method_to_string(m)); }
+ * @endcode
+ */
+#define REFLECT_ENUM(_Name, ...) \
+    __REFLECT_ENUM_TYPES(_Name, __VA_ARGS__) __REFLECT_ENUM_FUNCS(static, static inline, _Name, __VA_ARGS__)
+
+/**
+ * @brief Generates an enumeration and declares its name tables and string conversions.
+ * @param _Name The name of the enumeration type.
+ * @param ... The enumerators.
+ * @details The header form of `REFLECT_ENUM`: the enumeration and `_Name_COUNT` are complete, while the tables and
+ * the functions are only declared. `REFLECT_ENUM_DEFINE` with the same arguments emits them in one source file,
+ * so the tables exist once in the program and `_Name_from_string` is compiled once.
+ */
+#define REFLECT_ENUM_DECLARE(_Name, ...)                                          \
+    __REFLECT_ENUM_TYPES(_Name, __VA_ARGS__)                                      \
+    extern const char* const    CONCAT(_Name, _names)[CONCAT(_Name, _COUNT)];     \
+    extern const unsigned short CONCAT(_Name, _name_lens)[CONCAT(_Name, _COUNT)]; \
+    const char*                 CONCAT(_Name, _to_string)(_Name v);               \
+    int                         CONCAT(_Name, _from_string)(const char* s, size_t len, _Name* out);
+
+/**
+ * @brief Generates the name tables and string conversions of an enumeration declared by `REFLECT_ENUM_DECLARE`.
+ * @param _Name The name of the enumeration type.
+ * @param ... The enumerators.
+ */
+#define REFLECT_ENUM_DEFINE(_Name, ...) __REFLECT_ENUM_FUNCS(, , _Name, __VA_ARGS__)
+
+/* `_Data` and `_Link` are the storage classes of the tables and of the functions (internal, or external when empty) */
+#define __REFLECT_ENUM_TYPES(_Name, ...)              \
+    typedef enum _Name {                              \
+        FOR_EACH_I(__REFLECT_ENUM_VALUE, __VA_ARGS__) \
+    } _Name;                                          \
+    enum { CONCAT(_Name, _COUNT) = COUNT(__VA_ARGS__) };
+#define __REFLECT_ENUM_FUNCS(_Data, _Link, _Name, ...)                                                                         \
+    MCMT_MAYBE_UNUSED _Data const char* const    CONCAT(_Name, _names)[]     = { FOR_EACH(__REFLECT_ENUM_NAME, __VA_ARGS__) }; \
+    MCMT_MAYBE_UNUSED _Data const unsigned short CONCAT(_Name, _name_lens)[] = { FOR_EACH(__REFLECT_ENUM_LEN, __VA_ARGS__) };  \
+    _Link const char*          CONCAT(_Name, _to_string)(_Name v) {                                                            \
+        return (unsigned)v < CONCAT(_Name, _COUNT) ? CONCAT(_Name, _names)[v] : NULL;                                          \
+    }                                                                                                                          \
+    _Link int CONCAT(_Name, _from_string)(const char* s, size_t len, _Name* out) {                                             \
+        if (len == 0) { return 0; }                                                                                            \
+        FOR_EACH(__REFLECT_ENUM_MATCH, __VA_ARGS__)                                                                            \
+        return 0;                                                                                                              \
+    }
+
+#define __REFLECT_ENUM_VALUE(_i, _enumerator) _enumerator = _i,
+#define __REFLECT_ENUM_NAME(_enumerator)      #_enumerator,
+#define __REFLECT_ENUM_LEN(_enumerator)       sizeof(#_enumerator) - 1,
+#define __REFLECT_ENUM_MATCH(_enumerator)                                                                  \
+    if (len == sizeof(#_enumerator) - 1 && s[0] == #_enumerator[0] && memcmp(s, #_enumerator, len) == 0) { \
+        *out = _enumerator;                                                                                \
+        return 1;                                                                                          \
+    }
+
+#pragma endregion // mcmt_gen_enum
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_ENUM_H
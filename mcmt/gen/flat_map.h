@@ -0,0 +1,217 @@
+#ifndef MCMT_GEN_FLAT_MAP_H
+#define MCMT_GEN_FLAT_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../concat.h"
+
+/**********************************
+ * MCMT_GEN_FLAT_MAP_H
+ * @brief Macros for generating typed open-addressing hash maps.
+ *********************************/
+#pragma region mcmt_gen_flat_map
+
+/**
+ * @brief Capacity reserved by the first insertion into an empty flat map. It must be a power of two.
+ */
+#ifndef MCMT_FLAT_MAP_INITIAL_CAP
+#    define MCMT_FLAT_MAP_INITIAL_CAP 16
+#endif // !MCMT_FLAT_MAP_INITIAL_CAP
+
+/**
+ * @brief Generates a typed hash map with open addressing and linear probing.
+ * @param _Name The name of the map type.
+ * @param _K The key type.
+ * @param _V The value type.
+ * @param _HASH A function or macro called as `_HASH(key)` that returns the hash of a key as a `uint64_t`.
+ * @param _EQ A function or macro called as `_EQ(a, b)` that returns nonzero if two keys are equal.
+ * @details Every slot lives in flat arrays instead of chained nodes, so a lookup walks contiguous memory:
+ * - `meta`: one byte per slot, 0 for an empty slot, or the top 7 bits of the hash with the high bit set.
+ *   Probing compares these bytes first and only calls `_EQ` on a match.
+ * - `keys`, `vals`: the keys and the values, in separate arrays so that probing does not pull values into cache.
+ *
+ * All three arrays share one allocation. The capacity is a power of two, so the home slot is `hash & (cap - 1)`,
+ * and the map grows when it becomes more than 3/4 full. Erasing shifts the following entries of the probe sequence
+ * backward instead of leaving tombstones, so lookups never slow down after many erasures.
+ *
+ * This macro emits `_Name` and the following `static inline` functions:
+ * - `_Name_init`, `_Name_fini`: zero-initializes the map / releases its storage.
+ * - `_Name_reserve`: makes room for at least `n` entries, returns 0 on success and -1 on allocation failure or if the
+ *   slots for `n` entries would not fit in `size_t`.
+ * - `_Name_find`: returns a pointer to the value of `key`, or `NULL` if it is absent.
+ * - `_Name_insert`: inserts or overwrites `key`, returns 0 on success and -1 on allocation failure.
+ * - `_Name_erase`: removes `key`, returns 1 if it was present and 0 otherwise.
+ *
+ * Pointers returned by `_Name_find` are invalidated by any insertion or erasure.
+ * For example:
+ * @code
+ * static inline uint64_t u32_hash(uint32_t k) { return (uint64_t)k * 0x9E3779B97F4A7C15ull; }
+ * #define U32_EQ(_a, _b) ((_a) == (_b))
+ * FLAT_MAP(IdMap, uint32_t, double, u32_hash, U32_EQ)
+ *
+ * IdMap m;
+ * IdMap_init(&m);
+ * IdMap_insert(&m, 42, 1.5);
+ * double* v = IdMap_find(&m, 42);
+ * IdMap_erase(&m, 42);
+ * IdMap_fini(&m);
+ * @endcode
+ */
+#define FLAT_MAP(_Name, _K, _V, _HASH, _EQ) \
+    __FLAT_MAP_TYPES(_Name, _K, _V) __FLAT_MAP_FUNCS(static inline, _Name, _K, _V, _HASH, _EQ)
+
+/**
+ * @deprecated The former name of `FLAT_MAP`, too close to `FLAT_MAP_DEFINE`, which emits the functions with external
+ * linkage for a `FLAT_MAP_DECLARE` header.
+ */
+#define DEFINE_FLAT_MAP(_Name, _K, _V, _HASH, _EQ) FLAT_MAP(_Name, _K, _V, _HASH, _EQ)
+
+/**
+ * @brief Generates the type of a flat map and the prototypes of its functions.
+ * @param _Name The name of the map type.
+ * @param _K The key type.
+ * @param _V The value type.
+ * @details The header form of `FLAT_MAP`. The hash and equality functions are not needed here;
+ * `FLAT_MAP_DEFINE` takes them along with the other arguments and emits the functions in one source file.
+ */
+#define FLAT_MAP_DECLARE(_Name, _K, _V)                        \
+    __FLAT_MAP_TYPES(_Name, _K, _V)                            \
+    void CONCAT(_Name, _init)(_Name * self);                   \
+    void CONCAT(_Name, _fini)(_Name * self);                   \
+    _V*  CONCAT(_Name, _find)(const _Name* self, _K key);      \
+    int  CONCAT(_Name, _reserve)(_Name * self, size_t n);      \
+    int  CONCAT(_Name, _insert)(_Name * self, _K key, _V val); \
+    int  CONCAT(_Name, _erase)(_Name * self, _K key);
+
+/**
+ * @brief Generates the functions of a flat map declared by `FLAT_MAP_DECLARE`, with external linkage.
+ * @param _Name The name of the map type.
+ * @param _K The key type.
+ * @param _V The value type.
+ * @param _HASH The hash function, as for `FLAT_MAP`.
+ * @param _EQ The equality function, as for `FLAT_MAP`.
+ */
+#define FLAT_MAP_DEFINE(_Name, _K, _V, _HASH, _EQ) __FLAT_MAP_FUNCS(, _Name, _K, _V, _HASH, _EQ)
+
+#define __FLAT_MAP_TYPES(_Name, _K, _V) \
+    typedef struct _Name {              \
+        uint8_t* meta;                  \
+        _K*      keys;                  \
+        _V*      vals;                  \
+        size_t   len;                   \
+        size_t   cap;                   \
+    } _Name;
+/* `_Link` is the storage class of the public functions, the key and placement helpers stay internal in every form;
+ * `_HASH` and `_EQ` are only called by the key helpers, whose reserved-style parameters cannot shadow them */
+#define __FLAT_MAP_FUNCS(_Link, _Name, _K, _V, _HASH, _EQ)                                                            \
+    static inline uint64_t CONCAT(_Name, _key_hash)(_K mcmt_fm_key) {                                                 \
+        return (uint64_t)(_HASH(mcmt_fm_key));                                                                        \
+    }                                                                                                                 \
+    static inline int CONCAT(_Name, _key_eq)(_K mcmt_fm_a, _K mcmt_fm_b) {                                            \
+        return (_EQ(mcmt_fm_a, mcmt_fm_b)) != 0;                                                                      \
+    }                                                                                                                 \
+    _Link void CONCAT(_Name, _init)(_Name * self) {                                                                   \
+        memset(self, 0, sizeof(*self));                                                                               \
+    }                                                                                                                 \
+    _Link void CONCAT(_Name, _fini)(_Name * self) {                                                                   \
+        free(self->meta);                                                                                             \
+        memset(self, 0, sizeof(*self));                                                                               \
+    }                                                                                                                 \
+    _Link _V* CONCAT(_Name, _find)(const _Name* self, _K key) {                                                       \
+        uint64_t h    = 0;                                                                                            \
+        size_t   mask = 0;                                                                                            \
+        size_t   i    = 0;                                                                                            \
+        uint8_t  tag  = 0;                                                                                            \
+        if (!self->len) { return NULL; }                                                                              \
+        h    = CONCAT(_Name, _key_hash)(key);                                                                         \
+        mask = self->cap - 1;                                                                                         \
+        tag  = __FLAT_MAP_TAG(h);                                                                                     \
+        for (i = (size_t)h & mask; self->meta[i]; i = (i + 1) & mask) {                                               \
+            if (self->meta[i] == tag && CONCAT(_Name, _key_eq)(self->keys[i], key)) { return &self->vals[i]; }        \
+        }                                                                                                             \
+        return NULL;                                                                                                  \
+    }                                                                                                                 \
+    /* places an entry known to be absent, the caller guarantees a free slot */                                       \
+    static inline void CONCAT(_Name, _place)(_Name * self, uint64_t h, _K key, _V val) {                              \
+        size_t mask = self->cap - 1;                                                                                  \
+        size_t i    = (size_t)h & mask;                                                                               \
+        while (self->meta[i]) { i = (i + 1) & mask; }                                                                 \
+        self->meta[i] = __FLAT_MAP_TAG(h);                                                                            \
+        self->keys[i] = key;                                                                                          \
+        self->vals[i] = val;                                                                                          \
+        self->len += 1;                                                                                               \
+    }                                                                                                                 \
+    _Link int CONCAT(_Name, _reserve)(_Name * self, size_t n) {                                                       \
+        _Name  grown;                                                                                                 \
+        size_t cap = self->cap ? self->cap : MCMT_FLAT_MAP_INITIAL_CAP;                                               \
+        size_t i   = 0;                                                                                               \
+        while (n > cap - cap / 4) {                                                                                   \
+            if (cap > __FLAT_MAP_MAX_CAP(_K, _V) / 2) { return -1; }                                                  \
+            cap *= 2;                                                                                                 \
+        }                                                                                                             \
+        if (cap == self->cap) { return 0; }                                                                           \
+        if (__FLAT_MAP_ALLOC(&grown, cap, _K, _V)) { return -1; }                                                     \
+        for (i = 0; i < self->cap; ++i) {                                                                             \
+            if (self->meta[i]) {                                                                                      \
+                CONCAT(_Name, _place)(&grown, CONCAT(_Name, _key_hash)(self->keys[i]), self->keys[i], self->vals[i]); \
+            }                                                                                                         \
+        }                                                                                                             \
+        free(self->meta);                                                                                             \
+        *self = grown;                                                                                                \
+        return 0;                                                                                                     \
+    }                                                                                                                 \
+    _Link int CONCAT(_Name, _insert)(_Name * self, _K key, _V val) {                                                  \
+        _V* slot = CONCAT(_Name, _find)(self, key);                                                                   \
+        if (slot) {                                                                                                   \
+            *slot = val;                                                                                              \
+            return 0;                                                                                                 \
+        }                                                                                                             \
+        if (CONCAT(_Name, _reserve)(self, self->len + 1)) { return -1; }                                              \
+        CONCAT(_Name, _place)(self, CONCAT(_Name, _key_hash)(key), key, val);                                         \
+        return 0;                                                                                                     \
+    }                                                                                                                 \
+    _Link int CONCAT(_Name, _erase)(_Name * self, _K key) {                                                           \
+        _V*    slot = CONCAT(_Name, _find)(self, key);                                                                \
+        size_t mask = self->cap - 1;                                                                                  \
+        size_t i    = 0;                                                                                              \
+        size_t j    = 0;                                                                                              \
+        if (!slot) { return 0; }                                                                                      \
+        i = (size_t)(slot - self->vals);                                                                              \
+        /* shift back every following entry whose home slot does not lie in (i, j] */                                 \
+        for (j = (i + 1) & mask; self->meta[j]; j = (j + 1) & mask) {                                                 \
+            size_t home = (size_t)CONCAT(_Name, _key_hash)(self->keys[j]) & mask;                                     \
+            if (((j - home) & mask) >= ((j - i) & mask)) {                                                            \
+                self->meta[i] = self->meta[j];                                                                        \
+                self->keys[i] = self->keys[j];                                                                        \
+                self->vals[i] = self->vals[j];                                                                        \
+                i             = j;                                                                                    \
+            }                                                                                                         \
+        }                                                                                                             \
+        self->meta[i] = 0;                                                                                            \
+        self->len -= 1;                                                                                               \
+        return 1;                                                                                                     \
+    }
+
+/* the high bit marks an occupied slot, the 7 low bits hold the top of the hash */
+#define __FLAT_MAP_TAG(_h) ((uint8_t)(0x80u | (uint8_t)((_h) >> 57)))
+
+/* allocates the metadata, keys and values of `_cap` slots in one zeroed block, returns nonzero on failure */
+#define __FLAT_MAP_ALLOC(_map, _cap, _K, _V)                                                              \
+    ((_map)->keys = NULL, (_map)->vals = NULL, (_map)->len = 0, (_map)->cap = (_cap),                     \
+     (_map)->meta = (uint8_t*)calloc(1, __FLAT_MAP_VALS_OFFSET(_cap, _K, _V) + (_cap) * sizeof(_V)),      \
+     (_map)->meta ? ((_map)->keys = (_K*)(void*)((_map)->meta + __FLAT_MAP_KEYS_OFFSET(_cap, _K)),        \
+                     (_map)->vals = (_V*)(void*)((_map)->meta + __FLAT_MAP_VALS_OFFSET(_cap, _K, _V)), 0) \
+                  : -1)
+/* the largest number of slots whose block size, padding included, fits in size_t */
+#define __FLAT_MAP_MAX_CAP(_K, _V) ((SIZE_MAX - _Alignof(_K) - _Alignof(_V)) / (1 + sizeof(_K) + sizeof(_V)))
+#define __FLAT_MAP_ALIGN_UP(_size, _T)           (((_size) + (_Alignof(_T) - 1)) & ~(size_t)(_Alignof(_T) - 1))
+#define __FLAT_MAP_KEYS_OFFSET(_cap, _K)         __FLAT_MAP_ALIGN_UP((size_t)(_cap), _K)
+#define __FLAT_MAP_VALS_OFFSET(_cap, _K, _V)     __FLAT_MAP_ALIGN_UP(__FLAT_MAP_KEYS_OFFSET(_cap, _K) + (_cap) * sizeof(_K), _V)
+
+#pragma endregion // mcmt_gen_flat_map
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_FLAT_MAP_H
@@ -0,0 +1,98 @@
+#ifndef MCMT_GEN_KEYWORD_H
+#define MCMT_GEN_KEYWORD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../concat.h"
+#include "../for_each.h"
+
+/**********************************
+ * MCMT_GEN_KEYWORD_H
+ * @brief Macros for generating keyword matchers.
+ *********************************/
+#pragma region mcmt_gen_keyword
+
+/**
+ * @brief Packs the length, the first character and the last character of a string into one discriminating key.
+ * @param _s The string; it must not be empty.
+ * @param _len The length of the string.
+ * @details Applied to a string literal, every operand is folded by the compiler, so the key is a constant. The key is a
+ * `uint64_t`, not an `unsigned long`, which has 32 bits on Windows: the length keeps 48 bits, so two strings shorter
+ * than 2^48 characters have the same key only if they have the same length.
+ */
+#define KEYWORD_KEY(_s, _len) \
+    (((uint64_t)(_len) << 16) | ((uint64_t)(unsigned char)(_s)[0] << 8) | (uint64_t)(unsigned char)(_s)[(_len) - 1])
+
+/**
+ * @brief Generates a matcher function for a list of keywords.
+ * @param _Name The name of the matcher function.
+ * @param ... The keywords, as tokens. They are stringized, so they must be valid identifiers or numbers.
+ * @details This macro emits the following:
+ * - `_Name_<keyword>`: the index of each keyword, numbered from 0 in declaration order, and `_Name_COUNT`.
+ * - `_Name(s, len)`: returns the index of the keyword spelled by the `len` characters at `s`, or -1.
+ *
+ * The matcher computes `KEYWORD_KEY` of its input once, so the length and both end characters are decided together by
+ * a single integer compare per keyword against a constant the compiler folds from the stringized keyword; only a
+ * keyword whose key matches is confirmed with a `memcmp` of constant size, which compilers inline. The preprocessor
+ * cannot look inside a token, so the keys cannot be emitted as `case` labels; the compares form a chain of `if` on
+ * one variable instead, which optimizers may further lower into a decision tree. Keywords sharing a key stay correct:
+ * when the confirmation fails, the chain goes on to the next keyword, which may have the same key.
+ * No memory is allocated and no table is built at startup.
+ * For example:
+ * @code
+ * KEYWORD_MATCHER(verb, GET, HEAD, POST, PUT, DELETE, OPTIONS)
+ *
+ * switch (verb(s, len)) {
+ * case verb_GET: ...
+ * case -1: ... // unknown verb
+ * }
+ * @endcode
+ */
+#define KEYWORD_MATCHER(_Name, ...) __KEYWORD_MATCHER_TYPES(_Name, __VA_ARGS__) __KEYWORD_MATCHER_FUNC(static inline, _Name, __VA_ARGS__)
+
+/**
+ * @brief Generates the keyword indices of a matcher and the prototype of its function.
+ * @param _Name The name of the matcher function.
+ * @param ... The keywords, as tokens.
+ * @details The header form of `KEYWORD_MATCHER`; `KEYWORD_MATCHER_DEFINE` with the same arguments emits the function
+ * in one source file.
+ */
+#define KEYWORD_MATCHER_DECLARE(_Name, ...) __KEYWORD_MATCHER_TYPES(_Name, __VA_ARGS__) int _Name(const char* s, size_t len);
+
+/**
+ * @brief Generates the function of a matcher declared by `KEYWORD_MATCHER_DECLARE`, with external linkage.
+ * @param _Name The name of the matcher function.
+ * @param ... The keywords, as tokens.
+ */
+#define KEYWORD_MATCHER_DEFINE(_Name, ...) __KEYWORD_MATCHER_FUNC(, _Name, __VA_ARGS__)
+
+#define __KEYWORD_MATCHER_TYPES(_Name, ...)                        \
+    enum {                                                         \
+        FOR_EACH_WITH(__KEYWORD_MATCHER_INDEX, _Name, __VA_ARGS__) \
+            CONCAT(_Name, _COUNT)                                  \
+    };
+#define __KEYWORD_MATCHER_FUNC(_Link, _Name, ...)                 \
+    _Link int _Name(const char* s, size_t len) {                  \
+        uint64_t key;                                             \
+        if (len == 0 || (uint64_t)len >> 48) { return -1; }       \
+        key = KEYWORD_KEY(s, len);                                \
+        FOR_EACH_WITH(__KEYWORD_MATCHER_CASE, _Name, __VA_ARGS__) \
+        return -1;                                                \
+    }
+
+#define __KEYWORD_MATCHER_INDEX(_Name, _keyword) CONCAT3(_Name, _, _keyword),
+#define __KEYWORD_MATCHER_TEST(_keyword)         (memcmp(s, #_keyword, sizeof(#_keyword) - 1) == 0)
+#define __KEYWORD_MATCHER_KEY(_keyword)          KEYWORD_KEY(#_keyword, sizeof(#_keyword) - 1)
+
+/* one equality test of the key per keyword, on a single variable; the memcmp only runs when the key matches */
+#define __KEYWORD_MATCHER_CASE(_Name, _keyword)                                       \
+    if (key == __KEYWORD_MATCHER_KEY(_keyword) && __KEYWORD_MATCHER_TEST(_keyword)) { \
+        return CONCAT3(_Name, _, _keyword);                                           \
+    }
+
+#pragma endregion // mcmt_gen_keyword
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_KEYWORD_H
@@ -0,0 +1,39 @@
+#ifndef MCMT_GEN_PACKED_H
+#define MCMT_GEN_PACKED_H
+
+#include "../for_each.h"
+#include "../sort.h"
+
+/**********************************
+ * MCMT_GEN_PACKED_H
+ * @brief Macros for generating structures with padding-minimizing field order.
+ *********************************/
+#pragma region mcmt_gen_packed
+
+/**
+ * @brief Generates a structure whose fields are laid out in descending order of alignment.
+ * @param _Name The name of the structure.
+ * @param ... The fields, each enclosed as `(align, type, field)`, where `align` is the integer literal `_Alignof(type)`.
+ * @details Declaration order decides the layout of a C structure, and mixing small and large fields wastes bytes on
+ * padding. This macro sorts the fields at compile time with `SORT_DESC` on their alignment, so every field follows
+ * fields of equal or larger alignment and only the tail padding of the structure remains. The sort is stable, so fields
+ * of equal alignment keep their declaration order. Each declared alignment is checked against `_Alignof(type)`.
+ * For example:
+ * @code
+ * PACKED_STRUCT(Row, (1, char, flag), (8, double, price), (2, short, kind), (4, int, qty), (8, void*, next))
+ * // typedef struct Row { double price; void* next; int qty; short kind; char flag; } Row;  (24 bytes instead of 32)
+ * @endcode
+ */
+#define PACKED_STRUCT(_Name, ...)                                    \
+    typedef struct _Name {                                           \
+        FOR_EACH(__PACKED_STRUCT_FIELD_DECL, SORT_DESC(__VA_ARGS__)) \
+    } _Name
+
+#define __PACKED_STRUCT_FIELD_DECL(_align, _Type, _field)                                                       \
+    _Static_assert(_Alignof(_Type) == (_align), "PACKED_STRUCT: declared alignment of `" #_field "` is wrong"); \
+    _Type _field;
+
+#pragma endregion // mcmt_gen_packed
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_PACKED_H
@@ -0,0 +1,95 @@
+#ifndef MCMT_GEN_REGISTRY_H
+#define MCMT_GEN_REGISTRY_H
+
+#include "../pp.h"
+#include "../concat.h"
+#include "../arg.h"
+#include "../for_each.h"
+
+/**********************************
+ * MCMT_GEN_REGISTRY_H
+ * @brief Macros for generating registries of entries with dense compile-time IDs.
+ *********************************/
+#pragma region mcmt_gen_registry
+
+/**
+ * @brief Generates a registry that assigns each entry a dense compile-time ID.
+ * @param _Name The name of the registry.
+ * @param ... The entries, as tokens.
+ * @details This macro emits the following for the registry `_Name`:
+ * - `_Name`: an enumeration of IDs, `_Name_<entry>`, numbered densely from 0 in declaration order.
+ * - `_Name_COUNT`: the number of entries.
+ * - `_Name_names`: the name of each entry, indexed by its ID, a `static` table marked `MCMT_MAYBE_UNUSED`.
+ *
+ * Per-entry data then lives in plain arrays of `_Name_COUNT` elements (see `REGISTRY_ARRAY` and `REGISTRY_TABLE`),
+ * so hot paths index them by ID instead of hashing names at runtime. Keeping the entries in one list macro makes
+ * adding an entry a one-line edit.
+ * For example:
+ * @code
+ * #define METRICS requests, errors, latency_us
+ * REGISTRY(Metric, METRICS)
+ * REGISTRY_ARRAY(Metric, unsigned long, metric_values);
+ * REGISTRY_TABLE(Metric, const char*, metric_units, (requests, "req"), (errors, "err"), (latency_us, "us"));
+ *
+ * metric_values[Metric_errors] += 1;
+ * printf("%s: %lu %s\n", Metric_names[Metric_errors], metric_values[Metric_errors], metric_units[Metric_errors]);
+ * @endcode
+ */
+#define REGISTRY(_Name, ...) \
+    __REGISTRY_TYPES(_Name, __VA_ARGS__) MCMT_MAYBE_UNUSED static __REGISTRY_NAMES(_Name, __VA_ARGS__)
+
+/**
+ * @brief Generates the IDs of a registry and declares its names table.
+ * @param _Name The name of the registry.
+ * @param ... The entries, as tokens.
+ * @details The header form of `REGISTRY`: the enumeration and `_Name_COUNT` are complete, while `_Name_names` is only
+ * declared. `REGISTRY_DEFINE` with the same arguments emits it in one source file, so the table exists once in the
+ * program.
+ */
+#define REGISTRY_DECLARE(_Name, ...) \
+    __REGISTRY_TYPES(_Name, __VA_ARGS__) extern const char* const CONCAT(_Name, _names)[CONCAT(_Name, _COUNT)];
+
+/**
+ * @brief Generates the names table of a registry declared by `REGISTRY_DECLARE`, with external linkage.
+ * @param _Name The name of the registry.
+ * @param ... The entries, as tokens.
+ */
+#define REGISTRY_DEFINE(_Name, ...) __REGISTRY_NAMES(_Name, __VA_ARGS__)
+
+#define __REGISTRY_TYPES(_Name, ...)                     \
+    typedef enum _Name {                                 \
+        FOR_EACH_WITH(__REGISTRY_ID, _Name, __VA_ARGS__) \
+    } _Name;                                             \
+    enum { CONCAT(_Name, _COUNT) = COUNT(__VA_ARGS__) };
+#define __REGISTRY_NAMES(_Name, ...) const char* const CONCAT(_Name, _names)[] = { FOR_EACH(__REGISTRY_NAME, __VA_ARGS__) };
+
+/**
+ * @brief Declares an array holding one element per entry of a registry.
+ * @param _Name The name of the registry.
+ * @param _Type The element type.
+ * @param _array The name of the array.
+ * @details Storage class and initializer may be written around it, e.g. `static REGISTRY_ARRAY(Metric, int, hits) = { 0 };`.
+ */
+#define REGISTRY_ARRAY(_Name, _Type, _array) _Type _array[CONCAT(_Name, _COUNT)]
+
+/**
+ * @brief Defines a constant table holding one value per entry of a registry.
+ * @param _Name The name of the registry.
+ * @param _Type The element type.
+ * @param _table The name of the table.
+ * @param ... The values, each enclosed as `(entry, value)`, in any order.
+ * @details The values are placed with designated initializers at the ID of their entry, so the table does not depend
+ * on the order of the list, and a static assertion rejects a table whose number of values differs from `_Name_COUNT`.
+ */
+#define REGISTRY_TABLE(_Name, _Type, _table, ...)                                                                        \
+    _Static_assert(COUNT(__VA_ARGS__) == CONCAT(_Name, _COUNT), "REGISTRY_TABLE: " #_table " must cover every " #_Name); \
+    static const _Type _table[CONCAT(_Name, _COUNT)] = { FOR_EACH_WITH(__REGISTRY_VALUE, _Name, __VA_ARGS__) }
+
+#define __REGISTRY_ID(_Name, _entry)            CONCAT3(_Name, _, _entry),
+#define __REGISTRY_NAME(_entry)                 #_entry,
+#define __REGISTRY_VALUE(_Name, _entry, _value) [CONCAT3(_Name, _, _entry)] = _value,
+
+#pragma endregion // mcmt_gen_registry
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_REGISTRY_H
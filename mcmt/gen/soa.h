@@ -0,0 +1,175 @@
+#ifndef MCMT_GEN_SOA_H
+#define MCMT_GEN_SOA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../concat.h"
+#include "../for_each.h"
+
+/**********************************
+ * MCMT_GEN_SOA_H
+ * @brief Macros for generating structure-of-arrays (SoA) containers.
+ *********************************/
+#pragma region mcmt_gen_soa
+
+/**
+ * @brief Alignment in bytes of every field array of a generated SoA container.
+ * @details Define it before including this header to match the target's cache line.
+ * It must be a power of two and a multiple of `sizeof(void*)` (required by `aligned_alloc`).
+ */
+#ifndef MCMT_CACHE_LINE_SIZE
+#    define MCMT_CACHE_LINE_SIZE 64
+#endif // !MCMT_CACHE_LINE_SIZE
+
+/**
+ * @brief Allocates / releases the block of a SoA container, aligned on `MCMT_CACHE_LINE_SIZE`.
+ * @details C11 `aligned_alloc` and `free`, except on MSVC, which lacks `aligned_alloc` and pairs `_aligned_malloc` with
+ * `_aligned_free`. The size is always a multiple of the alignment, as `aligned_alloc` requires.
+ */
+#if defined(_MSC_VER)
+#    include <malloc.h>
+#    define __SOA_ALLOC(_size) _aligned_malloc(_size, MCMT_CACHE_LINE_SIZE)
+#    define __SOA_FREE(_ptr)   _aligned_free(_ptr)
+#else
+#    define __SOA_ALLOC(_size) aligned_alloc(MCMT_CACHE_LINE_SIZE, _size)
+#    define __SOA_FREE(_ptr)   free(_ptr)
+#endif // defined(_MSC_VER)
+
+/**
+ * @brief Capacity reserved by the first push into an empty SoA container.
+ */
+#ifndef MCMT_SOA_INITIAL_CAP
+#    define MCMT_SOA_INITIAL_CAP 16
+#endif // !MCMT_SOA_INITIAL_CAP
+
+/**
+ * @brief Rounds a byte size up to the next multiple of `MCMT_CACHE_LINE_SIZE`.
+ * @param _size The byte size to round up.
+ */
+#define SOA_ALIGN_UP(_size) (((_size) + (MCMT_CACHE_LINE_SIZE - 1)) & ~(size_t)(MCMT_CACHE_LINE_SIZE - 1))
+
+/**
+ * @brief Generates a structure-of-arrays container from a list of fields.
+ * @param _Name The name of the container type.
+ * @param ... The fields, each enclosed as `(type, field)`.
+ * @details This macro emits the following for the container `_Name`:
+ * - `_Name`: one array per field plus `len` and `cap`. All arrays live in a single block
+ *   and each of them starts on a `MCMT_CACHE_LINE_SIZE` boundary, so hot loops that touch a few fields
+ *   only pull those fields into cache and can be vectorized with aligned loads.
+ * - `_Name_View`: the array-of-structures (AoS) view of a single element.
+ * - `_Name_init`, `_Name_fini`: zero-initializes the container / releases its storage.
+ * - `_Name_reserve`: grows the capacity to at least `cap` elements, returns 0 on success and -1 on allocation failure
+ *   or if the block of `cap` elements would not fit in `size_t`.
+ * - `_Name_push`: appends an element, doubling the capacity when full, returns 0 on success and -1 on failure.
+ * - `_Name_get`, `_Name_set`: reads / writes the element at index `i` through its AoS view.
+ *
+ * Individual fields are accessed directly, e.g. `particles.x[i]`.
+ * For example:
+ * @code
+ * SOA_STRUCT(Particles, (float, x), (float, y), (float, z), (unsigned, id))
+ *
+ * Particles ps;
+ * Particles_init(&ps);
+ * Particles_push(&ps, (Particles_View){ .x = 1.0f, .y = 2.0f, .z = 3.0f, .id = 7 });
+ * for (size_t i = 0; i < ps.len; ++i) { ps.x[i] += ps.y[i]; }
+ * Particles_fini(&ps);
+ * @endcode
+ */
+#define SOA_STRUCT(_Name, ...) __SOA_STRUCT_TYPES(_Name, __VA_ARGS__) __SOA_STRUCT_FUNCS(static inline, _Name, __VA_ARGS__)
+
+/**
+ * @brief Generates the types of a structure-of-arrays container and the prototypes of its functions.
+ * @param _Name The name of the container type.
+ * @param ... The fields, each enclosed as `(type, field)`.
+ * @details Use it in a header instead of `SOA_STRUCT`, and `SOA_STRUCT_DEFINE` with the same arguments in a single
+ * source file, so that the function bodies are expanded and compiled once instead of in every translation unit.
+ */
+#define SOA_STRUCT_DECLARE(_Name, ...) __SOA_STRUCT_TYPES(_Name, __VA_ARGS__) __SOA_STRUCT_PROTOS(_Name)
+
+/**
+ * @brief Generates the functions of a structure-of-arrays container declared by `SOA_STRUCT_DECLARE`, with external linkage.
+ * @param _Name The name of the container type.
+ * @param ... The fields, each enclosed as `(type, field)`.
+ */
+#define SOA_STRUCT_DEFINE(_Name, ...) __SOA_STRUCT_FUNCS(, _Name, __VA_ARGS__)
+
+/* the parts shared by the three forms, `_Link` is the storage class of the functions (`static inline` or none) */
+#define __SOA_STRUCT_TYPES(_Name, ...)                      \
+    typedef struct _Name {                                  \
+        FOR_EACH(__SOA_STRUCT_FIELD_DECL, __VA_ARGS__)      \
+        size_t len;                                         \
+        size_t cap;                                         \
+        void*  block;                                       \
+    } _Name;                                                \
+    typedef struct CONCAT(_Name, _View) {                   \
+        FOR_EACH(__SOA_STRUCT_VIEW_FIELD_DECL, __VA_ARGS__) \
+    } CONCAT(_Name, _View);
+#define __SOA_STRUCT_FUNCS(_Link, _Name, ...)                                                         \
+    _Link void CONCAT(_Name, _init)(_Name * self) {                                                   \
+        memset(self, 0, sizeof(*self));                                                               \
+    }                                                                                                 \
+    _Link void CONCAT(_Name, _fini)(_Name * self) {                                                   \
+        __SOA_FREE(self->block);                                                                      \
+        memset(self, 0, sizeof(*self));                                                               \
+    }                                                                                                 \
+    _Link int CONCAT(_Name, _reserve)(_Name * self, size_t cap) {                                     \
+        size_t         size   = 0;                                                                    \
+        size_t         offset = 0;                                                                    \
+        unsigned char* block  = NULL;                                                                 \
+        if (cap <= self->cap) { return 0; }                                                           \
+        FOR_EACH(__SOA_STRUCT_FIELD_SIZE, __VA_ARGS__)                                                \
+        block = (unsigned char*)__SOA_ALLOC(size);                                                    \
+        if (!block) { return -1; }                                                                    \
+        FOR_EACH(__SOA_STRUCT_FIELD_MOVE, __VA_ARGS__)                                                \
+        __SOA_FREE(self->block);                                                                      \
+        self->block = block;                                                                          \
+        self->cap   = cap;                                                                            \
+        return 0;                                                                                     \
+    }                                                                                                 \
+    _Link int CONCAT(_Name, _push)(_Name * self, CONCAT(_Name, _View) elem) {                         \
+        size_t i = self->len;                                                                         \
+        if (i == self->cap && (i > SIZE_MAX / 2                                                       \
+                               || CONCAT(_Name, _reserve)(self, i ? i * 2 : MCMT_SOA_INITIAL_CAP))) { \
+            return -1;                                                                                \
+        }                                                                                             \
+        FOR_EACH(__SOA_STRUCT_FIELD_STORE, __VA_ARGS__)                                               \
+        self->len = i + 1;                                                                            \
+        return 0;                                                                                     \
+    }                                                                                                 \
+    _Link CONCAT(_Name, _View) CONCAT(_Name, _get)(const _Name* self, size_t i) {                     \
+        CONCAT(_Name, _View) elem;                                                                    \
+        FOR_EACH(__SOA_STRUCT_FIELD_LOAD, __VA_ARGS__)                                                \
+        return elem;                                                                                  \
+    }                                                                                                 \
+    _Link void CONCAT(_Name, _set)(_Name * self, size_t i, CONCAT(_Name, _View) elem) {               \
+        FOR_EACH(__SOA_STRUCT_FIELD_STORE, __VA_ARGS__)                                               \
+    }
+#define __SOA_STRUCT_PROTOS(_Name)                                         \
+    void CONCAT(_Name, _init)(_Name * self);                               \
+    void CONCAT(_Name, _fini)(_Name * self);                               \
+    int  CONCAT(_Name, _reserve)(_Name * self, size_t cap);                \
+    int  CONCAT(_Name, _push)(_Name * self, CONCAT(_Name, _View) elem);    \
+    CONCAT(_Name, _View) CONCAT(_Name, _get)(const _Name* self, size_t i); \
+    void CONCAT(_Name, _set)(_Name * self, size_t i, CONCAT(_Name, _View) elem);
+
+/* per-field code fragments, expanded by FOR_EACH over the `(type, field)` list */
+#define __SOA_STRUCT_FIELD_DECL(_Type, _field)      _Type* _field;
+#define __SOA_STRUCT_VIEW_FIELD_DECL(_Type, _field) _Type _field;
+/* size stays a multiple of MCMT_CACHE_LINE_SIZE, so the bound of the next field cannot wrap */
+#define __SOA_STRUCT_FIELD_SIZE(_Type, _field)                                               \
+    if (cap > (SIZE_MAX - size - (MCMT_CACHE_LINE_SIZE - 1)) / sizeof(_Type)) { return -1; } \
+    size += SOA_ALIGN_UP(cap * sizeof(_Type));
+#define __SOA_STRUCT_FIELD_MOVE(_Type, _field)                                                       \
+    if (self->len) { memcpy(block + offset, (const void*)self->_field, self->len * sizeof(_Type)); } \
+    self->_field = (_Type*)(void*)(block + offset);                                                  \
+    offset += SOA_ALIGN_UP(cap * sizeof(_Type));
+#define __SOA_STRUCT_FIELD_STORE(_Type, _field) self->_field[i] = elem._field;
+#define __SOA_STRUCT_FIELD_LOAD(_Type, _field)  elem._field = self->_field[i];
+
+#pragma endregion // mcmt_gen_soa
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_SOA_H
@@ -0,0 +1,77 @@
+#ifndef MCMT_GEN_SPECIALIZE_H
+#define MCMT_GEN_SPECIALIZE_H
+
+#include "../basic.h"
+#include "../concat.h"
+#include "../list.h"
+#include "../for_each.h"
+
+/**********************************
+ * MCMT_GEN_SPECIALIZE_H
+ * @brief Macros for instantiating a function once per type and dispatching to it with `_Generic`.
+ *********************************/
+#pragma region mcmt_gen_specialize
+
+/**
+ * @brief Instantiates a function body once per type.
+ * @param _Name The base name of the specialized functions.
+ * @param _BODY A macro called as `_BODY(fn, type)` that emits the definition of the function `fn` for `type`.
+ * @param ... The types, each enclosed as `(type, suffix)`.
+ * @details Emits `_BODY(_Name_<suffix>, type)` for each type, so `sum_f32`, `sum_f64`, ... are written once and each
+ * of them is still compiled (and optimized) for its own type. Calls are resolved statically by `SPECIALIZE_GENERIC`.
+ * Keeping the type list in a macro lets the instantiation and the dispatch share it.
+ * For example:
+ * @code
+ * #define SUM_TYPES (float, f32), (double, f64), (int, i32)
+ * #define SUM_BODY(_fn, _T)                              \
+ *     static inline _T _fn(const _T* xs, size_t n) {     \
+ *         _T s = 0;                                      \
+ *         for (size_t i = 0; i < n; ++i) { s += xs[i]; } \
+ *         return s;                                      \
+ *     }
+ * SPECIALIZE(sum, SUM_BODY, SUM_TYPES)
+ * #define sum(_xs, _n) SPECIALIZE_GENERIC(sum, *(_xs), SUM_TYPES)(_xs, _n)
+ * @endcode
+ */
+#define SPECIALIZE(_Name, _BODY, ...) FOR_EACH_WITH(__SPECIALIZE_INSTANCE, (_Name, _BODY), __VA_ARGS__)
+
+/**
+ * @brief Instantiates a function body once per pair of type and width.
+ * @param _Name The base name of the specialized functions.
+ * @param _BODY A macro called as `_BODY(fn, type, width)` that emits the definition of the function `fn`.
+ * @param _Types The types, enclosed as `((type, suffix), ...)`.
+ * @param _Widths The widths (e.g. unroll factors or vector lanes), enclosed as `(width, ...)`.
+ * @details Emits `_BODY(_Name_<suffix>_<width>, type, width)` for each pair, iterating with `FOR_EACH_2D`.
+ * Widths are compile-time constants, so the caller picks the width by name and `SPECIALIZE_GENERIC` can dispatch
+ * on the type of a fixed width, e.g. `SPECIALIZE_GENERIC(dot, *(_a), (float, f32_8), (double, f64_8))`.
+ */
+#define SPECIALIZE_2D(_Name, _BODY, _Types, _Widths) \
+    FOR_EACH_2D(__SPECIALIZE_2D_INSTANCE, __SPECIALIZE_2D_SPECS(FOR_EACH_WITH(__SPECIALIZE_2D_SPEC, (_Name, _BODY), UNCLOSE(_Types))), _Widths)
+
+/**
+ * @brief Selects the specialization of a function for the type of an expression.
+ * @param _Name The base name of the specialized functions.
+ * @param _x The expression whose type selects the specialization. It is not evaluated.
+ * @param ... The types, each enclosed as `(type, suffix)`.
+ * @return A `_Generic` selection resolving to `_Name_<suffix>` at compile time, without any runtime cost.
+ */
+#define SPECIALIZE_GENERIC(_Name, _x, ...) _Generic((_x)FOR_EACH_WITH(__SPECIALIZE_GENERIC_ASSOC, _Name, __VA_ARGS__))
+
+/* the context tuple of FOR_EACH_WITH is unpacked through an extra call so that its elements become separate arguments */
+#define __SPECIALIZE_INSTANCE(_Ctx, _Type, _suffix)             __SPECIALIZE_INSTANCE_UNPACK(UNCLOSE(_Ctx), _Type, _suffix)
+#define __SPECIALIZE_INSTANCE_UNPACK(...)                       __SPECIALIZE_INSTANCE_EMIT(__VA_ARGS__)
+#define __SPECIALIZE_INSTANCE_EMIT(_Name, _BODY, _Type, _suffix) _BODY(CONCAT3(_Name, _, _suffix), _Type)
+
+/* each type becomes `, (_Name, _BODY, type, suffix)`, the leading comma is dropped by LIST_TAIL once the list is expanded */
+#define __SPECIALIZE_2D_SPECS(...)                                     (LIST_TAIL(__VA_ARGS__))
+#define __SPECIALIZE_2D_SPEC(_Ctx, _Type, _suffix)                     , (UNCLOSE(_Ctx), _Type, _suffix)
+#define __SPECIALIZE_2D_INSTANCE(_Spec, _width)                        __SPECIALIZE_2D_INSTANCE_UNPACK(UNCLOSE(_Spec), _width)
+#define __SPECIALIZE_2D_INSTANCE_UNPACK(...)                           __SPECIALIZE_2D_INSTANCE_EMIT(__VA_ARGS__)
+#define __SPECIALIZE_2D_INSTANCE_EMIT(_Name, _BODY, _Type, _suffix, _width) _BODY(CONCAT5(_Name, _, _suffix, _, _width), _Type, _width)
+
+#define __SPECIALIZE_GENERIC_ASSOC(_Name, _Type, _suffix) , _Type : CONCAT3(_Name, _, _suffix)
+
+#pragma endregion // mcmt_gen_specialize
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_SPECIALIZE_H
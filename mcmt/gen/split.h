@@ -0,0 +1,95 @@
+#ifndef MCMT_GEN_SPLIT_H
+#define MCMT_GEN_SPLIT_H
+
+#include "../concat.h"
+#include "../extn_impl_ovld.h"
+#include "../for_each.h"
+
+/**********************************
+ * MCMT_GEN_SPLIT_H
+ * @brief Macros for generating hot/cold split structures.
+ *********************************/
+#pragma region mcmt_gen_split
+
+/**
+ * @brief Generates a structure split into a hot part and a cold part.
+ * @param _Name The name of the hot structure.
+ * @param ... The fields, each enclosed as `(HOT, type, field)` or `(COLD, type, field)`.
+ * @details Rarely used fields pollute the cache lines that hot loops walk through. This macro keeps
+ * the `HOT` fields in a compact `_Name` structure and moves the `COLD` fields to a separate `_Name_Cold`
+ * structure that the hot one links to through its `cold` pointer. The storage of the cold part is owned by the user.
+ *
+ * For every field, a `static inline` function `_Name_<field>_ref` returning a pointer to the field is emitted,
+ * and `SPLIT_FIELD(_Name, _ptr, _field)` accesses a field through it. Because the accessor hides whether a field is
+ * hot or cold, moving a field between `HOT` and `COLD` does not change its call sites.
+ * Each part must have at least one field.
+ * For example:
+ * @code
+ * SPLIT_STRUCT(Order, (HOT, double, price), (HOT, unsigned, qty), (COLD, long, created_at), (COLD, int, flags))
+ *
+ * Order_Cold cold = { 0 };
+ * Order      order = { .price = 1.5, .qty = 10, .cold = &cold };
+ * SPLIT_FIELD(Order, &order, qty) += 1;
+ * SPLIT_FIELD(Order, &order, created_at) = 1697000000;
+ * @endcode
+ */
+#define SPLIT_STRUCT(_Name, ...) \
+    __SPLIT_STRUCT_TYPES(_Name, __VA_ARGS__) FOR_EACH_WITH(__SPLIT_STRUCT_FIELD_REF_STATIC, _Name, __VA_ARGS__)
+
+/**
+ * @brief Generates the structures of a hot/cold split and the prototypes of its field accessors.
+ * @param _Name The name of the hot structure.
+ * @param ... The fields, each enclosed as `(HOT, type, field)` or `(COLD, type, field)`.
+ * @details The header form of `SPLIT_STRUCT`; `SPLIT_STRUCT_DEFINE` emits the accessors in one source file.
+ */
+#define SPLIT_STRUCT_DECLARE(_Name, ...) \
+    __SPLIT_STRUCT_TYPES(_Name, __VA_ARGS__) FOR_EACH_WITH(__SPLIT_STRUCT_FIELD_REF_PROTO, _Name, __VA_ARGS__)
+
+/**
+ * @brief Generates the field accessors of a structure declared by `SPLIT_STRUCT_DECLARE`, with external linkage.
+ * @param _Name The name of the hot structure.
+ * @param ... The fields, each enclosed as `(HOT, type, field)` or `(COLD, type, field)`.
+ */
+#define SPLIT_STRUCT_DEFINE(_Name, ...) FOR_EACH_WITH(__SPLIT_STRUCT_FIELD_REF_EXTERN, _Name, __VA_ARGS__)
+
+/**
+ * @brief Accesses a field of a structure generated by `SPLIT_STRUCT`, regardless of its part.
+ * @param _Name The name of the hot structure.
+ * @param _ptr A pointer to the hot structure.
+ * @param _field The name of the field.
+ * @return An lvalue designating the field.
+ */
+#define SPLIT_FIELD(_Name, _ptr, _field) (*CONCAT4(_Name, _, _field, _ref)(_ptr))
+
+/* classify each `(kind, type, field)` by pasting its kind */
+#define __SPLIT_STRUCT_HOT_FIELD_DECL(_Kind, _Type, _field)  OPER_IMPL_OVERLOAD_UNARY(SPLIT_STRUCT_HOT_FIELD_DECL_, _Kind)(_Type, _field)
+#define __SPLIT_STRUCT_HOT_FIELD_DECL_HOT(_Type, _field)     _Type _field;
+#define __SPLIT_STRUCT_HOT_FIELD_DECL_COLD(_Type, _field)
+#define __SPLIT_STRUCT_COLD_FIELD_DECL(_Kind, _Type, _field) OPER_IMPL_OVERLOAD_UNARY(SPLIT_STRUCT_COLD_FIELD_DECL_, _Kind)(_Type, _field)
+#define __SPLIT_STRUCT_COLD_FIELD_DECL_HOT(_Type, _field)
+#define __SPLIT_STRUCT_COLD_FIELD_DECL_COLD(_Type, _field)   _Type _field;
+
+#define __SPLIT_STRUCT_TYPES(_Name, ...)                      \
+    typedef struct CONCAT(_Name, _Cold) {                     \
+        FOR_EACH(__SPLIT_STRUCT_COLD_FIELD_DECL, __VA_ARGS__) \
+    } CONCAT(_Name, _Cold);                                   \
+    typedef struct _Name {                                    \
+        FOR_EACH(__SPLIT_STRUCT_HOT_FIELD_DECL, __VA_ARGS__)  \
+        CONCAT(_Name, _Cold) * cold;                          \
+    } _Name;
+
+/* emit one accessor per field, with the structure name passed as the context of FOR_EACH_WITH */
+#define __SPLIT_STRUCT_FIELD_REF_STATIC(_Name, _Kind, _Type, _field) __SPLIT_STRUCT_FIELD_REF(static inline, _Name, _Kind, _Type, _field)
+#define __SPLIT_STRUCT_FIELD_REF_EXTERN(_Name, _Kind, _Type, _field) __SPLIT_STRUCT_FIELD_REF(, _Name, _Kind, _Type, _field)
+#define __SPLIT_STRUCT_FIELD_REF_PROTO(_Name, _Kind, _Type, _field)  _Type* CONCAT4(_Name, _, _field, _ref)(_Name * self);
+#define __SPLIT_STRUCT_FIELD_REF(_Link, _Name, _Kind, _Type, _field)                      \
+    _Link _Type* CONCAT4(_Name, _, _field, _ref)(_Name * self) {                          \
+        return &OPER_IMPL_OVERLOAD_UNARY(SPLIT_STRUCT_FIELD_OWNER_, _Kind)(self)->_field; \
+    }
+#define __SPLIT_STRUCT_FIELD_OWNER_HOT(_self)  (_self)
+#define __SPLIT_STRUCT_FIELD_OWNER_COLD(_self) (_self)->cold
+
+#pragma endregion // mcmt_gen_split
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_SPLIT_H
@@ -0,0 +1,179 @@
+#ifndef MCMT_GEN_STATE_MACHINE_H
+#define MCMT_GEN_STATE_MACHINE_H
+
+#include "../concat.h"
+#include "../list.h"
+#include "../tuple.h"
+#include "../for_each.h"
+#include "dispatch.h"
+
+/**********************************
+ * MCMT_GEN_STATE_MACHINE_H
+ * @brief Macros for generating table-driven state machines from a list of transitions.
+ *********************************/
+#pragma region mcmt_gen_state_machine
+
+/**
+ * @brief Generates the states, input classes and dense transition table of a state machine.
+ * @param _Name The name of the state machine.
+ * @param _States The states, enclosed as `(state, ...)`; the first one is usually the start state.
+ * @param _Classes The input classes, enclosed as `(class, ...)`.
+ * @param ... The transitions, each enclosed as `(from, class, to, action)`. The action is a statement run by
+ * `STATE_MACHINE_RUN` when the transition is taken; it is optional and may contain commas.
+ * @details This macro emits the following for the state machine `_Name`:
+ * - `_Name_state`: an enumeration of the states, `_Name_<state>`, numbered from 1 in declaration order, after
+ *   `_Name_REJECT` (0), the state of an input with no transition; `_Name_STATE_COUNT` counts them with `_Name_REJECT`.
+ * - `_Name_class`: an enumeration of the input classes, `_Name_class_<class>`, and `_Name_CLASS_COUNT`.
+ * - `_Name_transitions`: the dense `[_Name_STATE_COUNT][_Name_CLASS_COUNT]` table of the transition taken from each
+ *   state on each class, numbered from 1 in the order of the list, or 0 if there is none.
+ * - `_Name_targets`: the state each transition leads to, indexed by its number, `_Name_REJECT` at 0.
+ * - `_Name_step(state, cls)`: returns the next state, by two loads from the tables and no branch.
+ *
+ * Each transition is placed in the table by a designated initializer, so the list may be in any order; a later
+ * transition for the same state and class overrides the earlier one, which `-Woverride-init` reports. Both tables are
+ * of `unsigned char` and a state machine has at most 255 states and 255 transitions, so the table of a tokenizer
+ * takes a few hundred bytes and stays in cache. The preprocessor cannot drop the duplicates from the `from` and `to`
+ * tokens of the transitions, so the states and the classes are listed separately.
+ * For example:
+ * @code
+ * #define NUM_RULES                                            \
+ *     (start, digit, integer, value = c - '0'),                \
+ *     (integer, digit, integer, value = value * 10 + c - '0'), \
+ *     (integer, point, fraction, ),                            \
+ *     (fraction, digit, fraction, )
+ * STATE_MACHINE(num, (start, integer, fraction), (digit, point, other), NUM_RULES)
+ * @endcode
+ */
+#define STATE_MACHINE(_Name, _States, _Classes, ...)   \
+    __STATE_MACHINE_TYPES(_Name, _States, _Classes)    \
+    __STATE_MACHINE_TABLES(static, _Name, __VA_ARGS__) \
+    __STATE_MACHINE_STEP(static inline, _Name)
+
+/**
+ * @brief Generates the states and input classes of a state machine, and the declarations of its tables and step.
+ * @param _Name The name of the state machine.
+ * @param _States The states, enclosed as `(state, ...)`.
+ * @param _Classes The input classes, enclosed as `(class, ...)`.
+ * @param ... The transitions, each enclosed as `(from, class, to, action)`.
+ * @details The header form of `STATE_MACHINE`; `STATE_MACHINE_DEFINE` with the same arguments emits the tables and
+ * the step function in one source file.
+ */
+#define STATE_MACHINE_DECLARE(_Name, _States, _Classes, ...)                                                          \
+    __STATE_MACHINE_TYPES(_Name, _States, _Classes)                                                                   \
+    extern const unsigned char CONCAT(_Name, _transitions)[CONCAT(_Name, _STATE_COUNT)][CONCAT(_Name, _CLASS_COUNT)]; \
+    extern const unsigned char CONCAT(_Name, _targets)[];                                                             \
+    CONCAT(_Name, _state) CONCAT(_Name, _step)(CONCAT(_Name, _state) state, unsigned cls);
+
+/**
+ * @brief Generates the tables and the step function of a state machine declared by `STATE_MACHINE_DECLARE`, with
+ * external linkage.
+ * @param _Name The name of the state machine.
+ * @param _States The states, enclosed as `(state, ...)`.
+ * @param _Classes The input classes, enclosed as `(class, ...)`.
+ * @param ... The transitions, each enclosed as `(from, class, to, action)`.
+ */
+#define STATE_MACHINE_DEFINE(_Name, _States, _Classes, ...) \
+    __STATE_MACHINE_TABLES(, _Name, __VA_ARGS__)            \
+    __STATE_MACHINE_STEP(, _Name)
+
+/**
+ * @brief Runs a state machine over its input, running the action of each transition taken.
+ * @param _Name The name of the state machine.
+ * @param _var The state variable, of type `_Name_state`, holding the start state; it holds the last state after.
+ * @param _more The condition to test before each step, e.g. `i < len`.
+ * @param _cls The input class of the next step, e.g. `classes[(unsigned char)text[i++]]`.
+ * @param ... The transitions given to `STATE_MACHINE`, typically through the same list macro.
+ * @details Place it in a function, as a statement. The machine steps while `_more` holds and stops early in
+ * `_Name_REJECT`. The actions run in the scope of the function, after `_var` is updated; they must not use `break`
+ * or `continue`, but may leave the run with `goto`. Only one run of a machine may be placed in a function.
+ *
+ * With computed goto (see `MCMT_DISPATCH_COMPUTED_GOTO`), each action is followed by its own copy of the step, which
+ * jumps straight to the action of the next transition, so every transition has its own indirect branch to predict.
+ * Otherwise the step is followed by a `switch` over the number of the transition, inside a loop.
+ * For example:
+ * @code
+ * num_state state = num_start;
+ * size_t i = 0;
+ * int c, value = 0;
+ * STATE_MACHINE_RUN(num, state, i < len, num_classify(c = text[i++]), NUM_RULES);
+ * if (state == num_integer) { ... }
+ * @endcode
+ */
+#if MCMT_DISPATCH_COMPUTED_GOTO
+#    define STATE_MACHINE_RUN(_Name, _var, _more, _cls, ...)                                                            \
+        do {                                                                                                            \
+            static void* const CONCAT(_Name, _run_labels)[] = {                                                         \
+                &&CONCAT(_Name, _run_end),                                                                              \
+                FOR_EACH_WITH(__STATE_MACHINE_LABEL_ADDRESS, _Name, __STATE_MACHINE_NUMBERED(__VA_ARGS__))              \
+            };                                                                                                          \
+            unsigned CONCAT(_Name, _run_t);                                                                             \
+            __STATE_MACHINE_GOTO_NEXT(_Name, _var, _more, _cls)                                                         \
+            FOR_EACH_WITH(__STATE_MACHINE_GOTO_CASE, (_Name, _var, _more, _cls), __STATE_MACHINE_NUMBERED(__VA_ARGS__)) \
+            CONCAT(_Name, _run_end) :;                                                                                  \
+        } while (0)
+#else // !MCMT_DISPATCH_COMPUTED_GOTO
+#    define STATE_MACHINE_RUN(_Name, _var, _more, _cls, ...)                                                         \
+        for (;;) {                                                                                                   \
+            unsigned CONCAT(_Name, _run_t);                                                                          \
+            if (!(_more)) { break; }                                                                                 \
+            CONCAT(_Name, _run_t) = CONCAT(_Name, _transitions)[_var][_cls];                                         \
+            (_var) = (CONCAT(_Name, _state))CONCAT(_Name, _targets)[CONCAT(_Name, _run_t)];                          \
+            if (!CONCAT(_Name, _run_t)) { break; }                                                                   \
+            switch (CONCAT(_Name, _run_t)) { FOR_EACH(__STATE_MACHINE_CASE, __STATE_MACHINE_NUMBERED(__VA_ARGS__)) } \
+        }
+#endif // MCMT_DISPATCH_COMPUTED_GOTO
+
+#define __STATE_MACHINE_TYPES(_Name, _States, _Classes)                                      \
+    typedef enum CONCAT(_Name, _state) {                                                     \
+        CONCAT(_Name, _REJECT),                                                              \
+        FOR_EACH_WITH(__STATE_MACHINE_STATE, _Name, UNCLOSE(_States))                        \
+            CONCAT(_Name, _STATE_COUNT)                                                      \
+    } CONCAT(_Name, _state);                                                                 \
+    enum CONCAT(_Name, _class) {                                                             \
+        FOR_EACH_WITH(__STATE_MACHINE_CLASS, _Name, UNCLOSE(_Classes))                       \
+            CONCAT(_Name, _CLASS_COUNT)                                                      \
+    };                                                                                       \
+    _Static_assert(CONCAT(_Name, _STATE_COUNT) <= 256 && CONCAT(_Name, _CLASS_COUNT) <= 256, \
+                   "STATE_MACHINE: " #_Name " has more than 255 states or 256 classes");
+#define __STATE_MACHINE_TABLES(_Link, _Name, ...)                                                                       \
+    _Link const unsigned char CONCAT(_Name, _transitions)[CONCAT(_Name, _STATE_COUNT)][CONCAT(_Name, _CLASS_COUNT)] = { \
+        FOR_EACH_WITH(__STATE_MACHINE_TRANSITION, _Name, __STATE_MACHINE_NUMBERED(__VA_ARGS__))                         \
+    };                                                                                                                  \
+    _Link const unsigned char CONCAT(_Name, _targets)[] = {                                                             \
+        CONCAT(_Name, _REJECT), FOR_EACH_WITH(__STATE_MACHINE_TARGET, _Name, __VA_ARGS__)                               \
+    };                                                                                                                  \
+    _Static_assert(sizeof(CONCAT(_Name, _targets)) <= 256, "STATE_MACHINE: " #_Name " has more than 255 transitions");
+#define __STATE_MACHINE_STEP(_Link, _Name)                                                              \
+    _Link CONCAT(_Name, _state) CONCAT(_Name, _step)(CONCAT(_Name, _state) state, unsigned cls) {       \
+        return (CONCAT(_Name, _state))CONCAT(_Name, _targets)[CONCAT(_Name, _transitions)[state][cls]]; \
+    }
+
+/* the transitions, each preceded by its number: (1, from, class, to, action), ... */
+#define __STATE_MACHINE_NUMBERED(...)      __STATE_MACHINE_NUMBERED_LIST(FOR_EACH_I(__STATE_MACHINE_NUMBER, __VA_ARGS__))
+#define __STATE_MACHINE_NUMBERED_LIST(...) LIST_TAIL(__VA_ARGS__)
+#define __STATE_MACHINE_NUMBER(_i, ...)    , (INC(_i), __VA_ARGS__)
+
+#define __STATE_MACHINE_STATE(_Name, _state)                           CONCAT3(_Name, _, _state),
+#define __STATE_MACHINE_CLASS(_Name, _cls)                             CONCAT3(_Name, _class_, _cls),
+#define __STATE_MACHINE_TRANSITION(_Name, _t, _from, _on, _to, ...) \
+    [CONCAT3(_Name, _, _from)][CONCAT3(_Name, _class_, _on)] = _t,
+#define __STATE_MACHINE_TARGET(_Name, _from, _on, _to, ...)            CONCAT3(_Name, _, _to),
+#define __STATE_MACHINE_CASE(_t, _from, _on, _to, ...)                 case _t: { __VA_ARGS__; } break;
+#define __STATE_MACHINE_LABEL_ADDRESS(_Name, _t, ...)                  &&CONCAT3(_Name, _run_, _t),
+
+/* computed goto: the action of a transition, then the step to the next one */
+#define __STATE_MACHINE_GOTO_CASE(_Ctx, _t, _from, _on, _to, ...) \
+    __STATE_MACHINE_GOTO_CASE_EXPAND(__STATE_MACHINE_GOTO_LABEL, (UNCLOSE(_Ctx), _t, __VA_ARGS__))
+#define __STATE_MACHINE_GOTO_CASE_EXPAND(_OP, _Args) _OP _Args
+#define __STATE_MACHINE_GOTO_LABEL(_Name, _var, _more, _cls, _t, ...) \
+    CONCAT3(_Name, _run_, _t) : { __VA_ARGS__; } __STATE_MACHINE_GOTO_NEXT(_Name, _var, _more, _cls)
+#define __STATE_MACHINE_GOTO_NEXT(_Name, _var, _more, _cls)                         \
+    if (!(_more)) { goto CONCAT(_Name, _run_end); }                                 \
+    CONCAT(_Name, _run_t) = CONCAT(_Name, _transitions)[_var][_cls];                \
+    (_var) = (CONCAT(_Name, _state))CONCAT(_Name, _targets)[CONCAT(_Name, _run_t)]; \
+    goto* CONCAT(_Name, _run_labels)[CONCAT(_Name, _run_t)];
+
+#pragma endregion // mcmt_gen_state_machine
+/*-------------------------------*/
+
+#endif // !MCMT_GEN_STATE_MACHINE_H
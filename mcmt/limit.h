@@ -0,0 +1,51 @@
+#ifndef MCMT_LIMIT_H
+#define MCMT_LIMIT_H
+
+/*********************************
+ * MCMT_LIMIT_H
+ * @brief Macros for reporting an invocation that exceeds a limit of the library.
+ *********************************/
+#pragma region mcmt_limit
+
+/**
+ * @brief The sentinel produced in place of a result that exceeds a limit of MCMT, reporting the limit.
+ * @param _Limit The name of the limit, e.g. `INC`.
+ * @param _Msg The message, a string literal naming the limit.
+ * @details Expands to the identifier `MCMT_LIMIT_EXCEEDED_<_Limit>`, which is never declared, so the compiler rejects
+ * the code using the result with an error naming the limit. With GCC and Clang, the sentinel also carries a
+ * `#pragma GCC error` reporting `_Msg` where it is expanded, which makes it an error of the preprocessor itself, with
+ * `-E` and in `#if` too. A sentinel dropped by the invocation that produced it, like the index computed past the last
+ * element of a list, reports nothing.
+ *
+ * The sentinels are placed at the first out-of-range step, so a recursion is cut short instead of running through the
+ * whole EVAL tower and failing on its leftover tokens:
+ * - `INC(MCMT_ARITH_MAX)` produces `MCMT_LIMIT_EXCEEDED_INC`, which `INC` and `DEC` keep unchanged, so the steps left
+ *   in `ADD`, `MUL` or `RANGE` pass it on without reporting it again.
+ * - `CMP` and the relations on top of it result in the sentinel of an operand, or in `MCMT_LIMIT_EXCEEDED_CMP` for an
+ *   operand past `MCMT_ARITH_MAX`, which `DIV`, `RANGE` and `INT_RANGE` stop on and give back (see `CMP_EXCEEDED_OR`).
+ * - `DIV` by 0, and `FOR_EACH_SLICE` or `RANGE_SLICE` into 0 chunks, produce `MCMT_LIMIT_EXCEEDED_DIV_BY_ZERO`.
+ * - `COUNT` of 129 arguments produces `MCMT_LIMIT_EXCEEDED_COUNT`, an identifier only.
+ * - `FOR_EACH` and its variants check that their list fits the EVAL budget, `MCMT_FOR_EACH_MAX` elements, before
+ *   starting, and produce `MCMT_LIMIT_EXCEEDED_FOR_EACH` otherwise. `FOR_EACH_2D` and `FOR_EACH_3D` check their rows
+ *   and columns together, each row taking as much of the budget as one element more.
+ *
+ * For example:
+ * @code
+ * int n = ADD(200, 100);
+ * // error: mcmt: INC exceeds MCMT_ARITH_MAX (256)
+ * // error: 'MCMT_LIMIT_EXCEEDED_INC' undeclared here (not in a function)
+ * @endcode
+ */
+#define MCMT_LIMIT_EXCEEDED(_Limit, _Msg) MCMT_LIMIT_EXCEEDED_##_Limit __MCMT_LIMIT_ERROR(_Msg)
+
+#if defined(__GNUC__)
+#    define __MCMT_LIMIT_ERROR(_Msg) __MCMT_LIMIT_PRAGMA(GCC error _Msg)
+#else
+#    define __MCMT_LIMIT_ERROR(_Msg)
+#endif // defined(__GNUC__)
+#define __MCMT_LIMIT_PRAGMA(...) _Pragma(#__VA_ARGS__)
+
+#pragma endregion // mcmt_limit
+/*-------------------------------*/
+
+#endif // !MCMT_LIMIT_H
@@ -0,0 +1,39 @@
+#ifndef MCMT_LIST_H
+#define MCMT_LIST_H
+
+#include "pp.h"
+#include "extn_impl_ovld.h"
+#include "recur.h"
+#include "logic.h"
+#include "tuple.h"
+
+/*********************************
+ * MCMT_LIST_H
+ *********************************/
+#pragma region mcmt_list
+
+#define LIST_HEAD(_arg, ...) _arg
+#define LIST_TAIL(arg, ...)  __VA_ARGS__
+
+#if MCMT_PP_VA_OPT
+#    include "list/va_opt.h"
+#else // !MCMT_PP_VA_OPT
+/* a list whose head is enclosed in parentheses (e.g. `(type, field), ...`) is never empty
+ * and must not reach the token pasting of the exists test */
+#    define IS_EMPTY(...) \
+        OPER_IMPL_OVERLOAD_UNARY(IS_EMPTY_, IS_ENCLOSED(__VA_ARGS__))(__VA_ARGS__)
+#    define __IS_EMPTY_1(...) 0
+#    define __IS_EMPTY_0(...)                        \
+        TRY_EXTRACT_EXISTS(                          \
+            DEFER(LIST_HEAD)(__VA_ARGS__ EXISTS(1)), \
+            0                                        \
+        )
+#endif // MCMT_PP_VA_OPT
+
+#define IS_NOT_EMPTY(...) \
+    NOT(IS_EMPTY(__VA_ARGS__))
+
+#pragma endregion // mcmt_list
+/*-------------------------------*/
+
+#endif // !MCMT_LIST_H
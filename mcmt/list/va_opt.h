@@ -0,0 +1,17 @@
+#ifndef MCMT_LIST_VA_OPT_H
+#define MCMT_LIST_VA_OPT_H
+
+/* MCMT_LIST_VA_OPT: the emptiness test of mcmt/list.h selected by MCMT_PP_VA_OPT */
+
+/* a system header to GCC and Clang, so that `-pedantic` does not warn that `__VA_OPT__` predates C23;
+ * nothing else is defined here */
+#if defined(__GNUC__)
+#    pragma GCC system_header
+#endif // defined(__GNUC__)
+
+/* the extra call rescans a deferred argument as the exists test of the portable form does */
+#define IS_EMPTY(...)              __IS_EMPTY_VA_OPT(__VA_ARGS__)
+#define __IS_EMPTY_VA_OPT(...)     __IS_EMPTY_HEAD(__VA_OPT__(0, ) 1, ~)
+#define __IS_EMPTY_HEAD(_arg, ...) _arg
+
+#endif // !MCMT_LIST_VA_OPT_H
@@ -0,0 +1,103 @@
+#ifndef MCMT_LOGIC_H
+#define MCMT_LOGIC_H
+
+#include "basic.h"
+#include "concat.h"
+#include "extn_impl_ovld.h"
+#include "arg.h"
+#include "bit_logic.h"
+
+/*********************************
+ * MCMT_LOGIC_H
+ *********************************/
+#pragma region mcmt_logic
+
+/* probe */
+#define IS_PROBE(...) SND(__VA_ARGS__, 0)
+#define PROBE()       ~, 1
+
+/* not */
+#define NOT(_value) IS_PROBE(OPER_IMPL_OVERLOAD_UNARY_UNEVAL(NOT_, _value))
+#define __NOT_0     PROBE()
+
+/* boolean */
+#define BOOL(_value) BIT_CMPL(NOT(_value))
+
+// TODO(DevDasae): Research IF structures for code readability
+/* if-statement: falseClause is optional */
+#define IF(_cond)     OPER_IMPL_OVERLOAD_UNARY(BIT_IF_, BOOL(_cond))
+#define IF_NOT(_cond) OPER_IMPL_OVERLOAD_UNARY(BIT_IF_NOT_, BOOL(_cond))
+
+#define WHEN(_pred)   IF(_pred)(UNCLOSE, IGNORE)
+#define UNLESS(_pred) IF_NOT(_pred)(UNCLOSE, IGNORE)
+
+/* lazy if-statement: IF_LAZY(_cond)(_TRUE, _FALSE)(...) calls only the selected macro, see BIT_IF_LAZY */
+#define IF_LAZY(_cond)       OPER_IMPL_OVERLOAD_UNARY(BIT_IF_LAZY_, BOOL(_cond))
+/* lazy when-statement: WHEN_LAZY(_pred)(_OP)(...) calls _OP only if the predicate holds, otherwise expands to nothing */
+#define WHEN_LAZY(_pred)     OPER_IMPL_OVERLOAD_UNARY(WHEN_LAZY_, BOOL(_pred))
+#define __WHEN_LAZY_0(_OP)   IGNORE
+#define __WHEN_LAZY_1(_OP)   _OP
+
+/******** exist_testing_macro ********/
+#pragma region exist_testing_macro
+
+/* test if the value is an existing macro */
+#define PATTERN_MATCH_EXISTS(...)  EXPANDED, EXISTS(__VA_ARGS__)) IGNORE(
+#define GET_PATTERN_EXISTS_RESULT(_EXISTS) (PRIM_CONCAT(PATTERN_MATCH_, _EXISTS), DOESNT_EXIST)
+
+/* extract the 2nd field in the tuple */
+#define GET_PATTERN_EXIST_VALUE_EXPANDER(EXPANDED, _existValue) _existValue
+#define GET_PATTERN_EXIST_VALUE(_resultPair)                    GET_PATTERN_EXIST_VALUE_EXPANDER _resultPair
+#define EXISTS_PATTERN(_value) \
+    GET_PATTERN_EXIST_VALUE(GET_PATTERN_EXISTS_RESULT(_value))
+
+/* return 1 if exists, otherwise 0 */
+#define DOES_VALUE_EXIST(_EXISTS)       OPER_IMPL_OVERLOAD_UNARY_UNEVAL(DOES_VALUE_EXIST_, _EXISTS)
+#define __DOES_VALUE_EXIST_DOESNT_EXIST 0
+#define __DOES_VALUE_EXIST_EXISTS(...)  1
+
+/* extract x from EXIST(x) */
+#define EXTRACT_VALUE(_value)       OPER_IMPL_OVERLOAD_UNARY_UNEVAL(EXTRACT_VALUE_, _value)
+#define __EXTRACT_VALUE_EXISTS(...) __VA_ARGS__
+
+/* extract value if exists, otherwise return given default value */
+#define TRY_EXTRACT_EXISTS(value, ...)          \
+    IF(DOES_VALUE_EXIST(EXISTS_PATTERN(value))) \
+    (                                           \
+        EXTRACT_VALUE(value), __VA_ARGS__       \
+    )
+
+#pragma endregion // exist_testing_macro
+/*------- exist_testing_macro -------*/
+
+/******** boolean_operations ********/
+#pragma region boolean_operations
+
+#define BOOL_OPER_OVERLOAD_UNARY(_OP_Suffixed, _x, _default)      TRY_EXTRACT_EXISTS(OPER_IMPL_OVERLOAD_UNARY_UNEVAL(_OP_Suffixed, _x), _default)
+#define BOOL_OPER_OVERLOAD_BINARY(_OP_Suffixed, _x, _y, _default) TRY_EXTRACT_EXISTS(OPER_IMPL_OVERLOAD_BINARY_UNEVAL(_OP_Suffixed, _x, _y), _default)
+
+#define AND(x, y) BOOL_OPER_OVERLOAD_BINARY(AND_, x, y, 0)
+#define __AND_11  EXISTS(1)
+
+#define OR(x, y) BOOL_OPER_OVERLOAD_BINARY(OR_, x, y, 1)
+#define __OR_00  EXISTS(0)
+
+#define XOR(x, y) BOOL_OPER_OVERLOAD_BINARY(XOR_, x, y, 0)
+#define __XOR_01  EXISTS(1)
+#define __XOR_10  EXISTS(1)
+
+#define IS_ZERO(x)     BOOL_OPER_OVERLOAD_UNARY(IS_ZERO_, x, 0)
+#define __IS_ZERO_0    EXISTS(1)
+#define IS_NOT_ZERO(x) NOT(IS_ZERO(x))
+
+#define IS_ONE(_x)     BOOL_OPER_OVERLOAD_UNARY(IS_ONE_, _x, 0)
+#define __IS_ONE_1     EXISTS(1)
+#define IS_NOT_ONE(_x) NOT(IS_ONE(_x))
+
+#pragma endregion // boolean_operations
+/*------- boolean_operations -------*/
+
+#pragma endregion // mcmt_logic
+/*-------------------------------*/
+
+#endif // !MCMT_LOGIC_H
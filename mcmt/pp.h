@@ -0,0 +1,70 @@
+#ifndef MCMT_PP_H
+#define MCMT_PP_H
+
+/*********************************
+ * MCMT_PP_H
+ * @brief Macros identifying the preprocessor and the compiler, and selecting their fast paths.
+ *********************************/
+#pragma region mcmt_pp
+
+/**
+ * @brief The name of the preprocessor expanding MCMT, as a string literal.
+ * @details One of `"gcc"`, `"clang"`, `"msvc"`, `"tcc"`, `"mcpp"` or `"other"`. mcpp and TCC are tested first, as
+ * they may predefine the macros of the compiler they stand in for. tools/mcmt_pp_matrix.py prints it for every
+ * preprocessor it runs, to check which fast paths each one selected.
+ */
+#if defined(__MCPP)
+#    define MCMT_PP_NAME "mcpp"
+#elif defined(__TINYC__)
+#    define MCMT_PP_NAME "tcc"
+#elif defined(__clang__)
+#    define MCMT_PP_NAME "clang"
+#elif defined(_MSC_VER)
+#    define MCMT_PP_NAME "msvc"
+#elif defined(__GNUC__)
+#    define MCMT_PP_NAME "gcc"
+#else
+#    define MCMT_PP_NAME "other"
+#endif // defined(__MCPP)
+
+/**
+ * @brief 1 if the emptiness tests use `__VA_OPT__`, 0 if they use the portable probe.
+ * @details `IS_EMPTY` is evaluated at every step of `FOR_EACH` and of the list engines. Its portable form appends
+ * `EXISTS(1)` to the list and tests its head through `TRY_EXTRACT_EXISTS`, which takes several scans; with
+ * `__VA_OPT__` it is a single substitution: `IS_EMPTY` is about ten times and `FOR_EACH` over long lists about 20%
+ * faster on GCC. Both forms give the same results, a deferred argument included, as checked by tools/mcmt_pp_matrix.py.
+ *
+ * It is selected for GCC 8 and Clang 12 onwards, which accept `__VA_OPT__` in every C mode, and for no other
+ * preprocessor: TCC and mcpp do not support it, and MSVC only with `/Zc:preprocessor`. It is defined in
+ * mcmt/list/va_opt.h, a system header, so `-pedantic` does not warn that `__VA_OPT__` predates C23. Define
+ * `MCMT_PP_VA_OPT` to 0 before including MCMT to keep the portable form, or to 1 to select it on another conforming
+ * preprocessor.
+ */
+#if !defined(MCMT_PP_VA_OPT)
+#    if defined(__MCPP) || defined(__TINYC__) || defined(_MSC_VER)
+#        define MCMT_PP_VA_OPT 0
+#    elif defined(__clang__)
+#        define MCMT_PP_VA_OPT (__clang_major__ >= 12)
+#    elif defined(__GNUC__)
+#        define MCMT_PP_VA_OPT (__GNUC__ >= 8)
+#    else
+#        define MCMT_PP_VA_OPT 0
+#    endif // defined(__MCPP) || defined(__TINYC__) || defined(_MSC_VER)
+#endif // !defined(MCMT_PP_VA_OPT)
+
+/**
+ * @brief Marks a generated definition that the translation unit may leave unused.
+ * @details The generators emit their lookup tables as `static const` arrays, for every table that the caller might
+ * read, so `-Wall` (`-Wunused-const-variable`) would warn in each translation unit using only some of them. Expands to
+ * `__attribute__((unused))` on GCC, Clang and TCC, and to nothing elsewhere; MSVC does not warn about them.
+ */
+#if defined(__GNUC__) || defined(__clang__) || defined(__TINYC__)
+#    define MCMT_MAYBE_UNUSED __attribute__((unused))
+#else
+#    define MCMT_MAYBE_UNUSED
+#endif // defined(__GNUC__) || defined(__clang__) || defined(__TINYC__)
+
+#pragma endregion // mcmt_pp
+/*-------------------------------*/
+
+#endif // !MCMT_PP_H
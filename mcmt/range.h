@@ -0,0 +1,123 @@
+#ifndef MCMT_RANGE_H
+#define MCMT_RANGE_H
+
+#include "recur.h"
+#include "logic.h"
+#include "list.h"
+#include "for_each.h"
+#include "arith.h"
+#include "arith/signed.h"
+
+/*********************************
+ * MCMT_RANGE_H
+ *********************************/
+#pragma region mcmt_range
+
+#define OUTPUT_RANGE_VAL(_x) _x,
+
+/* EVAL_LIMIT rather than EVAL, whose MCMT_TRACE breadcrumb would become part of the values of the range */
+#define RANGE(_start, _end, _step)        EVAL_LIMIT(RANGE_UNEVAL(_start, _end, _step))
+#define RANGE_UNEVAL(_start, _end, _step) __RANGE_UNEVAL(_start, _end, _step) _end
+#define __RANGE_UNEVAL(_start, _end, _step)               \
+    MCMT_TRACE_STEP(2, RANGE_UNEVAL, _start, _end, _step) \
+    IF_LAZY(LESS_EQ(_end, _start))(__RANGE_DONE, __RANGE_STEP)(_start, _end, _step)
+#define __RANGE_STEP(_start, _end, _step) \
+    OUTPUT_RANGE_VAL(_start) DEFER(RANGE_INDIRECT)()(ADD(_start, _step), _end, _step)
+/* nothing, or the sentinel of a value past the table (see MCMT_LIMIT_EXCEEDED) */
+#define __RANGE_DONE(_start, _end, _step) CMP_EXCEEDED_OR(LESS_EQ(_end, _start), )
+#define RANGE_INDIRECT() __RANGE_UNEVAL
+
+/**
+ * @brief Generates the range of signed numbers from `_start` to `_end` by `_step`, as a list of C literals.
+ * @param _start The first value, a signed number (see `INT_LITERAL`).
+ * @param _end The last value, a signed number.
+ * @param _step The step, a non-zero signed number: a negative step makes a descending range.
+ * @details Like `RANGE`, the values are emitted while they are before `_end`, followed by `_end` itself; a negative
+ * number is emitted as a literal, e.g. `INT_RANGE(2, NEG(2), NEG(2))` results in `2, 0, -2`. The direction is read
+ * once from the sign of `_step`, and each value is then tested with `INT_LESS_EQ` or `INT_GREATER_EQ` and stepped with
+ * `INT_ADD`. Like `FOR_EACH`, a range can have up to `MCMT_FOR_EACH_MAX` values.
+ */
+#define INT_RANGE(_start, _end, _step) EVAL_LIMIT(INT_RANGE_UNEVAL(_start, _end, _step))
+#define INT_RANGE_UNEVAL(_start, _end, _step) \
+    __INT_RANGE_UNEVAL(__INT_RANGE_REACHED(_step), _start, _end, _step) INT_LITERAL(_end)
+#define __INT_RANGE_UNEVAL(_REACHED, _start, _end, _step)     \
+    MCMT_TRACE_STEP(2, INT_RANGE_UNEVAL, _start, _end, _step) \
+    IF_LAZY(_REACHED(_end, _start))(__INT_RANGE_DONE, __INT_RANGE_STEP)(_REACHED, _start, _end, _step)
+#define __INT_RANGE_STEP(_REACHED, _start, _end, _step) \
+    OUTPUT_RANGE_VAL(INT_LITERAL(_start)) DEFER(INT_RANGE_INDIRECT)()(_REACHED, INT_ADD(_start, _step), _end, _step)
+#define __INT_RANGE_DONE(_REACHED, _start, _end, _step) CMP_EXCEEDED_OR(_REACHED(_end, _start), )
+#define INT_RANGE_INDIRECT()                            __INT_RANGE_UNEVAL
+
+/* the relation of _end to the values that reach it: INT_LESS_EQ for an ascending range, INT_GREATER_EQ otherwise */
+#define __INT_RANGE_REACHED(_step)       __INT_EXPAND(__INT_RANGE_REACHED_SIGN, (__INT_SPLIT(_step)))
+#define __INT_RANGE_REACHED_SIGN(_s, _m) OPER_IMPL_OVERLOAD_UNARY(INT_RANGE_REACHED_, _s)
+#define __INT_RANGE_REACHED_P            INT_LESS_EQ
+#define __INT_RANGE_REACHED_N            INT_GREATER_EQ
+
+/**
+ * @brief Generates the `_k`-th (zero-based) of `_M` contiguous chunks of `RANGE(_start, _end, _step)`, as a list.
+ * @details The chunks are cut like `FOR_EACH_SLICE` cuts the values of the range, but only the values of the chunk are
+ * generated: the number of values and the chunk size are counted one unit at a time with `DEC`, then the distance
+ * from the first value of the chunk to `_end` is walked down the same way, and only the chunk is stepped with `ADD`.
+ * A chunk past the end of the range is empty; a bound or step past the table produces its sentinel, as `RANGE` does,
+ * and slicing into 0 chunks produces `MCMT_LIMIT_EXCEEDED_DIV_BY_ZERO`.
+ */
+#define RANGE_SLICE(_k, _M, _start, _end, _step)                                                         \
+    IF_LAZY(__RANGE_SLICE_EXCEEDED(_start, _end, _step, 0))(__RANGE_SLICE_EXCEEDED, __RANGE_SLICE_FITS)( \
+        _start, _end, _step, , _k, _M)
+/* 0, or the sentinel of a bound or step past the table (see MCMT_LIMIT_EXCEEDED), which IF_LAZY takes as true */
+#define __RANGE_SLICE_EXCEEDED(_start, _end, _step, _Else, ...) \
+    CMP_EXCEEDED_OR(LESS(_start, _end), CMP_EXCEEDED_OR(LESS(_step, _end), _Else))
+#define __RANGE_SLICE_FITS(_start, _end, _step, _Else, _k, _M) \
+    BIT_IF_LAZY(IS_ZERO(_M))(__RANGE_SLICE_NO_CHUNK, __RANGE_SLICE_CHUNKS)(_k, _M, _start, _end, _step)
+#define __RANGE_SLICE_NO_CHUNK(...) MCMT_LIMIT_EXCEEDED(DIV_BY_ZERO, "mcmt: RANGE_SLICE into 0 chunks")
+/* a single chunk is the whole range, whose 257 values would not fit the chunk size */
+#define __RANGE_SLICE_CHUNKS(_k, _M, _start, _end, _step) \
+    BIT_IF_LAZY(IS_ONE(_M))(__RANGE_SLICE_WHOLE, __RANGE_SLICE_DIST)(_k, _M, _start, _end, _step)
+#define __RANGE_SLICE_WHOLE(_k, _M, _start, _end, _step) IF_LAZY(IS_ZERO(_k))(RANGE, IGNORE)(_start, _end, _step)
+/* _d = _end - _start units, _c = ceil(_d / _step) values before _end, and _c + 1 values of _size = ceil((_c + 1) / _M) */
+#define __RANGE_SLICE_DIST(_k, _M, _start, _end, _step) __RANGE_SLICE_COUNT(_k, _M, _end, _step, SUB(_end, _start))
+#define __RANGE_SLICE_COUNT(_k, _M, _end, _step, _d) \
+    __RANGE_SLICE_SIZE(_k, _M, _end, _step, _d,      \
+                       BIT_IF_LAZY(IS_ONE(_step))(__RANGE_SLICE_UNITS, __FOR_EACH_SLICE_SIZE)(0, _d, _step))
+#define __RANGE_SLICE_UNITS(_Hi, _d, _step) _d
+#define __RANGE_SLICE_SIZE(_k, _M, _end, _step, _d, _c) \
+    __RANGE_SLICE_FIND(_k, _end, _step, _d, _c, __FOR_EACH_SLICE_SIZE(1, _c, _M))
+#define __RANGE_SLICE_FIND(_k, _end, _step, _d, _c, _size) \
+    __RANGE_SLICE_FOUND(_end, _step, _size, ARITH_L1_EVAL(__RANGE_SLICE_FIND_UNEVAL(_d, _c, _k, _size, _step, _size, _step)))
+
+/* skip _k chunks: each unit moves the first value toward _end, each _step units (or reaching _end) end a value; the
+ * walk stops with the chunk found (_k is 0), or with the values used up (_c is 0), leaving _w units to _end */
+#define __RANGE_SLICE_FIND_UNEVAL(_w, _c, _k, _e, _s, _size, _step)                              \
+    IF_LAZY(BIT_OR(IS_ZERO(_k), IS_ZERO(_c)))(__RANGE_SLICE_FIND_DONE, __RANGE_SLICE_FIND_STEP)( \
+        _w, _c, _k, _e, _s, _size, _step)
+#define __RANGE_SLICE_FIND_DONE(_w, _c, _k, _e, _s, _size, _step) IS_ZERO(_k), _w
+#define __RANGE_SLICE_FIND_STEP(_w, _c, _k, _e, _s, _size, _step)                              \
+    DEFER(__RANGE_SLICE_FIND_INDIRECT)()(DEC(_w), BIT_IF_LAZY(BIT_OR(IS_ONE(_s), IS_ONE(_w)))( \
+        __RANGE_SLICE_NEXT_VAL, __RANGE_SLICE_SAME_VAL)(_c, _k, _e, _s, _size, _step))
+#define __RANGE_SLICE_SAME_VAL(_c, _k, _e, _s, _size, _step) _c, _k, _e, DEC(_s), _size, _step
+#define __RANGE_SLICE_NEXT_VAL(_c, _k, _e, _s, _size, _step) \
+    DEC(_c), BIT_IF_LAZY(IS_ONE(_e))(__RANGE_SLICE_NEXT_CHUNK, __RANGE_SLICE_SAME_CHUNK)(_k, _e, _size), _step, _size, _step
+#define __RANGE_SLICE_NEXT_CHUNK(_k, _e, _size) DEC(_k), _size
+#define __RANGE_SLICE_SAME_CHUNK(_k, _e, _size) _k, DEC(_e)
+#define __RANGE_SLICE_FIND_INDIRECT()           __RANGE_SLICE_FIND_UNEVAL
+
+/* up to _size values of RANGE from _end - _w, or nothing when the chunk is past the end of the range */
+#define __RANGE_SLICE_FOUND(...) __RANGE_SLICE_FOUND_UNEVAL(__VA_ARGS__)
+#define __RANGE_SLICE_FOUND_UNEVAL(_end, _step, _size, _found, _w) \
+    BIT_IF_LAZY(_found)(__RANGE_SLICE_VALS, IGNORE)(SUB(_end, _w), _end, _step, _size)
+#define __RANGE_SLICE_VALS(_v, _end, _step, _n) EVAL_LIMIT(__RANGE_SLICE_UNEVAL(_v, _end, _step, _n))
+#define __RANGE_SLICE_UNEVAL(_v, _end, _step, _n) \
+    IF_LAZY(LESS_EQ(_end, _v))(__RANGE_SLICE_END, __RANGE_SLICE_VAL)(_v, _end, _step, _n)
+#define __RANGE_SLICE_VAL(_v, _end, _step, _n) IF_LAZY(IS_ONE(_n))(__RANGE_SLICE_LAST, __RANGE_SLICE_STEP)(_v, _end, _step, _n)
+#define __RANGE_SLICE_STEP(_v, _end, _step, _n) \
+    OUTPUT_RANGE_VAL(_v) DEFER(__RANGE_SLICE_INDIRECT)()(ADD(_v, _step), _end, _step, DEC(_n))
+#define __RANGE_SLICE_LAST(_v, _end, _step, _n) _v
+/* _end, or the sentinel of a value past the table (see MCMT_LIMIT_EXCEEDED) */
+#define __RANGE_SLICE_END(_v, _end, _step, _n) CMP_EXCEEDED_OR(LESS_EQ(_end, _v), _end)
+#define __RANGE_SLICE_INDIRECT()               __RANGE_SLICE_UNEVAL
+
+#pragma endregion // mcmt_range
+/*-------------------------------*/
+
+#endif // !MCMT_RANGE_H
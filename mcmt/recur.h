@@ -0,0 +1,187 @@
+#ifndef MCMT_RECUR_H
+#define MCMT_RECUR_H
+
+#include "basic.h"
+
+/**********************************
+ * MCMT_RECUR_H
+ *********************************/
+#pragma region mcmt_recur
+
+/******** MCMT_RECUR_DEFER_H ********/
+#pragma region mcmt_recur_defer
+
+/**
+ * @brief Defer macro expansion of its arguments.
+ * @param ... The arguments to be deferred.
+ * @details The DEFER macro is designed to defer the expansion of its arguments. It effectively delays the expansion of
+ * the provided arguments, allowing them to be evaluated later in the preprocessing phase. This is particularly useful
+ * for controlling the order of macro expansions and solving issues related to macro ordering.
+ *
+ * The DEFER macro is used in conjunction with other macros,
+ * such as `RECUR`, `EVAL`, `IF - (Conditional Branch Closures)`to manage the sequence of macro evaluations.
+ * For example, you can use them as follows:
+ * Part of the definition of the `ADD` Recursive function:
+ * @code
+ * #define ADD_UNEVAL(_A, _N) \
+ *   IF_LAZY( IS_NOT_ZERO(_N) ) ( __ADD_STEP, FST )( _A, _N )
+ * #define __ADD_STEP(_A, _N) \
+ *   DEFER( ADD_INDIRECT )()( INC(_A), DEC(_N) )
+ * @endcode
+ * When passed as a parameter:
+ * @code
+ * TRY_EXTRACT_EXISTS( DEFER( LIST_HEAD )( __VA_ARGS__ EXISTS(1) ), 0 )
+ * @endcode
+ */
+#define DEFER(...)  __VA_ARGS__ EMPTY()
+#define DEFER1(...) __VA_ARGS__ EMPTY()
+
+/**
+ * @brief Defer macro expansion twice.
+ * @param ... The arguments to be deferred twice.
+ * @details To defer expansion twice, the DEFER2 macro adds an additional deferred EMPTY() call. This allows for further
+ * control over the order of macro expansions and can be useful in scenarios where precise sequencing is required.
+ */
+#define DEFER2(...) __VA_ARGS__ DEFER(EMPTY)()
+#define DEFER3(...) __VA_ARGS__ DEFER2(EMPTY)()
+#define DEFER4(...) __VA_ARGS__ DEFER3(EMPTY)()
+#define DEFER5(...) __VA_ARGS__ DEFER4(EMPTY)()
+#define DEFER6(...) __VA_ARGS__ DEFER5(EMPTY)()
+#define DEFER7(...) __VA_ARGS__ DEFER6(EMPTY)()
+#define DEFER8(...) __VA_ARGS__ DEFER7(EMPTY)()
+
+#pragma endregion // mcmt_recur_defer
+/*------- MCMT_RECUR_DEFER_H -------*/
+
+/******** MCMT_RECUR_TRACE_H ********/
+#pragma region mcmt_recur_trace
+
+/**
+ * @brief Breadcrumbs of the recursion engines, emitted only when `MCMT_TRACE` is defined before including this header.
+ * @param _Level The trace level from which the breadcrumb is emitted, 1 or 2.
+ * @param _Engine The name of the recursive macro.
+ * @param ... The arguments of the current step.
+ * @details A breadcrumb is a `_Pragma("GCC warning ...")` numbered with `__COUNTER__` in the order the steps were
+ * expanded, so the compiler output reads as a log of the expansion:
+ * @code
+ * warning: mcmt: 1 EVAL
+ * warning: mcmt: 0 FOR_EACH_UNEVAL: F, a, b, c
+ * warning: mcmt: 2 FOR_EACH_UNEVAL: F, b, c
+ * @endcode
+ * Each step of a recursion uses one scan of its tower, so a recursion whose steps stop before its base case has run out
+ * of scans, and the last arguments reported show where.
+ * - `MCMT_TRACE` (or `MCMT_TRACE=1`): `EVAL` and the steps of `FOR_EACH`, whose expansions are code.
+ * - `MCMT_TRACE=2`: also the steps of `RANGE` and `INT_RANGE`, each with the operands of the `ADD` or `INT_ADD` that
+ *   computes its next value.
+ *
+ * A breadcrumb is a token of the expansion it traces. Numbers are looked up by token pasting, so the arithmetic, whose
+ * results are operands of further arithmetic, is never traced, and `RANGE` is evaluated without the `EVAL` breadcrumb.
+ * At level 2 the values of a range carry the breadcrumbs of its steps: a range expanded on its own is unchanged, but
+ * one passed to an operator that pastes its elements is not. `GCC warning` is handled by the preprocessor itself, which
+ * keeps breadcrumbs valid inside expressions; GCC and Clang support it, but as warnings, so do not build with `-Werror`
+ * in trace mode. Without `MCMT_TRACE` every breadcrumb expands to nothing, `__COUNTER__` included, and the expansion of
+ * every engine is unchanged. Breadcrumbs can also be placed in user-defined engines.
+ */
+#define MCMT_TRACE_ENTER(_Level, _Engine)     __MCMT_TRACE_AT_##_Level(mcmt: __COUNTER__ _Engine)
+#define MCMT_TRACE_STEP(_Level, _Engine, ...) __MCMT_TRACE_AT_##_Level(mcmt: __COUNTER__ _Engine: __VA_ARGS__)
+
+#if defined(MCMT_TRACE)
+#    define __MCMT_TRACE_AT_1(...) __MCMT_TRACE_PRAGMA(GCC warning __MCMT_TRACE_STR(__VA_ARGS__))
+#else
+#    define __MCMT_TRACE_AT_1(...)
+#endif
+#if defined(MCMT_TRACE) && (MCMT_TRACE + 0) >= 2
+#    define __MCMT_TRACE_AT_2(...) __MCMT_TRACE_PRAGMA(GCC warning __MCMT_TRACE_STR(__VA_ARGS__))
+#else
+#    define __MCMT_TRACE_AT_2(...)
+#endif
+#define __MCMT_TRACE_PRAGMA(...)        __MCMT_TRACE_PRAGMA_UNEVAL(__VA_ARGS__)
+#define __MCMT_TRACE_PRAGMA_UNEVAL(...) _Pragma(#__VA_ARGS__)
+#define __MCMT_TRACE_STR(...)           __MCMT_TRACE_STR_UNEVAL(__VA_ARGS__)
+#define __MCMT_TRACE_STR_UNEVAL(...)    #__VA_ARGS__
+
+#pragma endregion // mcmt_recur_trace
+/*------- MCMT_RECUR_TRACE_H -------*/
+
+/******** MCMT_RECUR_EVAL_H ********/
+#pragma region mcmt_recur_eval_h
+
+/**
+ * @brief The top-level EVAL macro.
+ * @param ... The arguments to be repeatedly expanded.
+ * @return The result of multiple evaluations of the arguments.
+ * @details The EVAL macro calls EVAL_LIMIT, which limits the number of recursive expansions to a predefined level.
+ * This top-level macro provides a convenient way to apply multiple evaluations to a set of arguments without the need to
+ * manually specify the recursion depth.
+ */
+#define EVAL(...)  MCMT_TRACE_ENTER(1, EVAL) EVAL_LIMIT(__VA_ARGS__)
+#define EVAL0(...) __VA_ARGS__
+#define EVAL1(...) EVAL0(__VA_ARGS__)
+#define EVAL2(...) EVAL1(EVAL1(__VA_ARGS__))
+#define EVAL3(...) EVAL2(EVAL2(__VA_ARGS__))
+#define EVAL4(...) EVAL3(EVAL3(__VA_ARGS__))
+#define EVAL5(...) EVAL4(EVAL4(__VA_ARGS__))
+#define EVAL6(...) EVAL5(EVAL5(__VA_ARGS__))
+#define EVAL7(...) EVAL6(EVAL6(__VA_ARGS__))
+
+/**
+ * @brief EVAL is a recursive macro that expands its arguments multiple times.
+ * @param ... The arguments to be repeatedly expanded.
+ * @return The result of multiple evaluations of the arguments.
+ * @details EVAL is a macro designed for recursive expansion of its arguments. When EVAL is called, it repeatedly expands
+ * its arguments using a lower-level EVAL macro, effectively doubling the number of expansions with each recursion level.
+ * This allows for 2^n evaluations of an expression, where n is the number of times EVAL is nested.
+ *
+ * The EVAL macro is a powerful tool for achieving multiple levels of macro expansion, enabling advanced metaprogramming
+ * techniques in C. However, it's important to be cautious with its usage, as excessive recursion can lead to long
+ * compilation times or even compilation errors.
+ *
+ * The maximum number of possible evaluations depends on the number of nested EVAL calls. In the provided code, EVAL_LIMIT
+ * is defined to limit the number of recursive expansions to eight levels. You can increase or decrease this limit
+ * according to your specific needs, but be mindful of the potential impact on compilation performance.
+ */
+#define EVAL_LIMIT(...) EVAL7(EVAL7(__VA_ARGS__))
+// #define EVAL_LIMIT(...) EVAL8(EVAL8(EVAL8(EVAL8(EVAL8(EVAL8(EVAL8(EVAL8(__VA_ARGS__))))))))
+
+#pragma endregion // mcmt_recur_eval_h
+/*------- MCMT_RECUR_EVAL_H -------*/
+
+/**
+ * @brief Recursively expands its arguments and displays expansion results sequentially.
+ * @param ... The arguments to be expanded recursively.
+ * @details This macro is used for recursive expansion of its arguments. It repeatedly expands its arguments
+ * and sequentially displays the expansion results according to the evaluation level. Each level of expansion
+ * results is separated by numbers to indicate the evaluation level.
+ * For example, if used as `RECUR(MACRO)`, it will display the expansion results as follows:
+ * 1)   MACRO RECUR_INDIRECT ()(MACRO)
+ * 1-1) MACRO RECUR_UNEVAL(MACRO)
+ * 2)   MACRO MACRO RECUR_INDIRECT ()(MACRO)
+ * 2-1) MACRO MACRO RECUR_UNEVAL(MACRO)
+ * 3)   MACRO MACRO MACRO RECUR_INDIRECT ()(MACRO)
+ * ...
+ */
+#define RECUR(...) EVAL(RECUR_UNEVAL(__VA_ARGS__))
+
+/**
+ * @brief Helper macro for recursive expansion.
+ * @param ... The arguments to be expanded recursively.
+ * @details This macro is used internally by `RECUR` to provide the recursive expansion functionality.
+ * It expands its arguments and incorporates `DEFER(RECUR_INDIRECT)()` to ensure proper sequencing of
+ * the expansion results for each level.
+ * This the same as #define RECUR(x) x DEFER(RECUR_INDIRECT) () (x)
+ * -> #define RECUR_UNEVAL(x)         x RECUR_INDIRECT EMPTY()()(x)
+ */
+#define RECUR_UNEVAL(...) __VA_ARGS__ DEFER(RECUR_INDIRECT)()(__VA_ARGS__)
+
+/**
+ * @brief Indirect macro for recursive expansion.
+ * @details This macro is used internally by `RECUR` and `RECUR_UNEVAL` to create an indirect recursive call.
+ * It ensures that the recursive expansion process can continue and maintains the sequencing of expansion results
+ * for each level.
+ */
+#define RECUR_INDIRECT() RECUR_UNEVAL
+
+#pragma endregion // mcmt_recur
+/*-------------------------------*/
+
+#endif // !MCMT_RECUR_H
@@ -0,0 +1,106 @@
+#ifndef MCMT_SORT_H
+#define MCMT_SORT_H
+
+#include "basic.h"
+#include "extn_impl_ovld.h"
+#include "recur.h"
+#include "bit_logic.h"
+#include "list.h"
+#include "tuple.h"
+#include "arith.h"
+
+/*********************************
+ * MCMT_SORT_H
+ *********************************/
+#pragma region mcmt_sort
+
+/**
+ * @brief Stably sorts a list of `(key, payload...)` tuples by their integer keys.
+ * @param ... The tuples to sort. Keys must lie in the range of the arithmetic tables.
+ * @return The sorted, comma-separated tuples.
+ * @details The sort is a bottom-up merge sort written as a single flat state machine: each step either orders a pair
+ * of input tuples, moves one tuple into the run being merged, or starts the next pair of runs. Since keys are compared
+ * with the constant-depth `LESS`/`GREATER` and no step nests another recursive macro, a list of n tuples takes
+ * about n * log2(n) steps, all driven by `SORT_EVAL`. Tuples with equal keys keep their relative order.
+ * For example, `SORT((4, a), (1, b), (8, c), (1, d))` results in `(1, b), (1, d), (4, a), (8, c)`.
+ */
+#define SORT(...) SORT_EVAL(__SORT_PAIR(LESS, (), __VA_ARGS__))
+
+/**
+ * @brief Stably sorts a list of `(key, payload...)` tuples by their integer keys in descending order.
+ * @param ... The tuples to sort.
+ * @return The sorted, comma-separated tuples.
+ * @details For example, `SORT_DESC((4, a), (1, b), (8, c), (1, d))` results in `(8, c), (4, a), (1, b), (1, d)`.
+ */
+#define SORT_DESC(...) SORT_EVAL(__SORT_PAIR(GREATER, (), __VA_ARGS__))
+
+/**
+ * SORT_EVAL is deeper than EVAL: its 2^12 scans cover the n * log2(n) steps of sorting up to 256 tuples.
+ */
+#define SORT_EVAL(...)       SORT_EVAL_LIMIT(__VA_ARGS__)
+#define SORT_EVAL0(...)      __VA_ARGS__
+#define SORT_EVAL1(...)      SORT_EVAL0(__VA_ARGS__)
+#define SORT_EVAL2(...)      SORT_EVAL1(SORT_EVAL1(__VA_ARGS__))
+#define SORT_EVAL3(...)      SORT_EVAL2(SORT_EVAL2(__VA_ARGS__))
+#define SORT_EVAL4(...)      SORT_EVAL3(SORT_EVAL3(__VA_ARGS__))
+#define SORT_EVAL5(...)      SORT_EVAL4(SORT_EVAL4(__VA_ARGS__))
+#define SORT_EVAL6(...)      SORT_EVAL5(SORT_EVAL5(__VA_ARGS__))
+#define SORT_EVAL7(...)      SORT_EVAL6(SORT_EVAL6(__VA_ARGS__))
+#define SORT_EVAL8(...)      SORT_EVAL7(SORT_EVAL7(__VA_ARGS__))
+#define SORT_EVAL9(...)      SORT_EVAL8(SORT_EVAL8(__VA_ARGS__))
+#define SORT_EVAL10(...)     SORT_EVAL9(SORT_EVAL9(__VA_ARGS__))
+#define SORT_EVAL11(...)     SORT_EVAL10(SORT_EVAL10(__VA_ARGS__))
+#define SORT_EVAL_LIMIT(...) SORT_EVAL11(SORT_EVAL11(__VA_ARGS__))
+
+#define __SORT_KEY(_Item)              __SORT_KEY_UNEVAL _Item
+#define __SORT_KEY_UNEVAL(_Key, ...)   _Key
+#define __SORT_APPEND(_List, ...)      OPER_IMPL_OVERLOAD_UNARY(SORT_APPEND_, IS_EMPTY(UNCLOSE(_List)))(_List, __VA_ARGS__)
+#define __SORT_APPEND_0(_List, ...)    (UNCLOSE(_List), __VA_ARGS__)
+#define __SORT_APPEND_1(_List, ...)    (__VA_ARGS__)
+#define __SORT_ORDER(_BEFORE, _X, _Y)  BIT_IF(_BEFORE(__SORT_KEY(_Y), __SORT_KEY(_X)), (_Y, _X), (_X, _Y))
+
+/* pass 0: order adjacent tuples into runs of two */
+#define __SORT_PAIR(_BEFORE, _Runs, ...)                                                                 \
+    OPER_IMPL_OVERLOAD_BINARY(SORT_PAIR_, IS_EMPTY(__VA_ARGS__), IS_EMPTY(LIST_TAIL(__VA_ARGS__))) \
+    (_BEFORE, _Runs, __VA_ARGS__)
+#define __SORT_PAIR_00(_BEFORE, _Runs, _X, _Y, ...) \
+    DEFER2(__SORT_PAIR_INDIRECT)()(_BEFORE, __SORT_APPEND(_Runs, __SORT_ORDER(_BEFORE, _X, _Y)), __VA_ARGS__)
+#define __SORT_PAIR_01(_BEFORE, _Runs, _X)   DEFER2(__SORT_NEXT_INDIRECT)()(_BEFORE, (), UNCLOSE(__SORT_APPEND(_Runs, (_X))))
+#define __SORT_PAIR_11(_BEFORE, _Runs, ...)  DEFER2(__SORT_NEXT_INDIRECT)()(_BEFORE, (), UNCLOSE(_Runs))
+#define __SORT_PAIR_INDIRECT()               __SORT_PAIR
+
+/* pass 1..: merge the next two runs, or finish the pass when less than two are left */
+#define __SORT_NEXT(_BEFORE, _Merged, ...)                                                               \
+    OPER_IMPL_OVERLOAD_BINARY(SORT_NEXT_, IS_EMPTY(__VA_ARGS__), IS_EMPTY(LIST_TAIL(__VA_ARGS__))) \
+    (_BEFORE, _Merged, __VA_ARGS__)
+#define __SORT_NEXT_00(_BEFORE, _Merged, _A, _B, ...) DEFER2(__SORT_MERGE_INDIRECT)()(_BEFORE, _Merged, (), _A, _B, __VA_ARGS__)
+#define __SORT_NEXT_01(_BEFORE, _Merged, _A)          __SORT_PASS(_BEFORE, __SORT_APPEND(_Merged, _A))
+#define __SORT_NEXT_11(_BEFORE, _Merged, ...)         __SORT_PASS(_BEFORE, _Merged)
+#define __SORT_NEXT_INDIRECT()                        __SORT_NEXT
+
+/* a pass that produced a single run is the result */
+#define __SORT_PASS(_BEFORE, _Runs)   OPER_IMPL_OVERLOAD_UNARY(SORT_PASS_, IS_EMPTY(LIST_TAIL _Runs))(_BEFORE, _Runs)
+#define __SORT_PASS_0(_BEFORE, _Runs) DEFER2(__SORT_NEXT_INDIRECT)()(_BEFORE, (), UNCLOSE(_Runs))
+#define __SORT_PASS_1(_BEFORE, _Runs) UNCLOSE_OPT(LIST_HEAD _Runs)
+
+/* merge runs _A and _B into _Run, one tuple per step; _B only wins on a strict _BEFORE to keep the sort stable */
+#define __SORT_MERGE(_BEFORE, _Merged, _Run, _A, _B, ...)                                               \
+    OPER_IMPL_OVERLOAD_BINARY(SORT_MERGE_, IS_EMPTY(UNCLOSE(_A)), IS_EMPTY(UNCLOSE(_B))) \
+    (_BEFORE, _Merged, _Run, _A, _B, __VA_ARGS__)
+#define __SORT_MERGE_00(_BEFORE, _Merged, _Run, _A, _B, ...)                                  \
+    OPER_IMPL_OVERLOAD_UNARY(SORT_MERGE_TAKE_, _BEFORE(__SORT_KEY(LIST_HEAD _B), __SORT_KEY(LIST_HEAD _A))) \
+    (_BEFORE, _Merged, _Run, _A, _B, __VA_ARGS__)
+#define __SORT_MERGE_01(_BEFORE, _Merged, _Run, _A, _B, ...) \
+    DEFER2(__SORT_NEXT_INDIRECT)()(_BEFORE, __SORT_APPEND(_Merged, (UNCLOSE(_Run), UNCLOSE(_A))), __VA_ARGS__)
+#define __SORT_MERGE_10(_BEFORE, _Merged, _Run, _A, _B, ...) \
+    DEFER2(__SORT_NEXT_INDIRECT)()(_BEFORE, __SORT_APPEND(_Merged, (UNCLOSE(_Run), UNCLOSE(_B))), __VA_ARGS__)
+#define __SORT_MERGE_TAKE_0(_BEFORE, _Merged, _Run, _A, _B, ...) \
+    DEFER2(__SORT_MERGE_INDIRECT)()(_BEFORE, _Merged, __SORT_APPEND(_Run, LIST_HEAD _A), (LIST_TAIL _A), _B, __VA_ARGS__)
+#define __SORT_MERGE_TAKE_1(_BEFORE, _Merged, _Run, _A, _B, ...) \
+    DEFER2(__SORT_MERGE_INDIRECT)()(_BEFORE, _Merged, __SORT_APPEND(_Run, LIST_HEAD _B), _A, (LIST_TAIL _B), __VA_ARGS__)
+#define __SORT_MERGE_INDIRECT() __SORT_MERGE
+
+#pragma endregion // mcmt_sort
+/*-------------------------------*/
+
+#endif // !MCMT_SORT_H
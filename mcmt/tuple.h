@@ -0,0 +1,32 @@
+#ifndef MCMT_TUPLE_H
+#define MCMT_TUPLE_H
+
+#include "basic.h"
+#include "extn_impl_ovld.h"
+#include "logic.h"
+
+/*********************************
+ * MCMT_TUPLE_H
+ *********************************/
+#pragma region mcmt_tuple
+
+/* test if arguments is enclosed in parentheses */
+#define IS_ENCLOSED(_x, ...) TRY_EXTRACT_EXISTS(TEST_ENCLOSED _x, 0)
+#define TEST_ENCLOSED(...)   EXISTS(1)
+
+// TODO(DevDasae): Apply BIT_IF
+#define IF_ENCLOSED(...)                  OPER_IMPL_OVERLOAD_UNARY(IF_ENCLOSED_, IS_ENCLOSED(__VA_ARGS__))
+#define __IF_ENCLOSED_0(trueClause, ...)  __VA_ARGS__
+#define __IF_ENCLOSED_1(_trueClause, ...) _trueClause
+
+#define UNCLOSE_OPT(...)      \
+    IF_ENCLOSED(__VA_ARGS__)  \
+    (                         \
+        UNCLOSE(__VA_ARGS__), \
+        __VA_ARGS__           \
+    )
+
+#pragma endregion // mcmt_tuple
+/*-------------------------------*/
+
+#endif // !MCMT_TUPLE_H
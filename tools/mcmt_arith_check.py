@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+"""Exhaustive differential check and cost map of the macrometa (MCMT) arithmetic.
+
+Generates every operand pair in the supported domain of the arithmetic and comparison macros, checks each result
+against C arithmetic with `_Static_assert`, and records what the checks cost the preprocessor. The cases of an
+operation are split into rows, one per value of the operand that drives the recursion (the second one), and each row
+is compiled as one translation unit, so the report gives the time of every row: a map of the cost of the operation
+over its domain, to compare an optimization against.
+
+The domain of an operation is the set of operands for which the library defines a result: every intermediate value
+stays in [0, MCMT_ARITH_MAX] (256), or in [0, MCMT_ARITH_BITS_MAX] (511) for the bit operations. `SUB` saturates at 0
+and `DIV` rounds down, as documented in mcmt/arith.h. The signed operations of mcmt/arith/signed.h (`INT_ADD`, ...)
+are checked over [-MCMT_ARITH_MAX, MCMT_ARITH_MAX], their negative operands written as `NEG(n)` and their results
+read back through `INT_LITERAL`.
+
+Only the local compiler is used (GCC or Clang), so the tool runs offline.
+
+Usage:
+    tools/mcmt_arith_check.py [options] [operation ...] [-- compiler flags]
+
+For example, checking the comparisons, and writing the cost map of MUL to a CSV file:
+    tools/mcmt_arith_check.py CMP LESS MIN MAX
+    tools/mcmt_arith_check.py --csv mul.csv MUL
+"""
+
+import argparse
+import concurrent.futures
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+ARITH_MAX = 256
+BITS_MAX = 511
+PRELUDE = """#include "mcmt/arith.h"
+#include "mcmt/arith/bits.h"
+#include "mcmt/arith/signed.h"
+#define __CHECK_CMP_LT -1
+#define __CHECK_CMP_EQ 0
+#define __CHECK_CMP_GT 1
+#define CHECK_CMP(_a, _b) CONCAT(__CHECK_CMP_, CMP(_a, _b))
+#define CHECK_INT_CMP(_a, _b) CONCAT(__CHECK_CMP_, INT_CMP(_a, _b))
+"""
+ERROR_RE = re.compile(r"^[^:\n]*probe\.c:(\d+):(?:\d+:)? (?:fatal )?error: (.*)$", re.M)
+
+
+def binom_in_domain(n, k):
+    """Follows BINOM_UNEVAL: both products must stay in the tables, DEC saturating at 0."""
+    numer, denom = 1, 1
+    while k:
+        numer, denom = numer * n, denom * k
+        if numer > ARITH_MAX or denom > ARITH_MAX:
+            return False
+        n, k = max(n - 1, 0), k - 1
+    return True
+
+
+def binom(n, k):
+    numer, denom = 1, 1
+    for i in range(k):
+        numer, denom = numer * max(n - i, 0), denom * (k - i)
+    return numer // denom
+
+
+def table():
+    """Returns the operations: name -> (macro expression, expected C expression, cases as (row, a, b))."""
+    full = range(ARITH_MAX + 1)
+    bits = range(BITS_MAX + 1)
+    signed = range(-ARITH_MAX, ARITH_MAX + 1)
+    pairs = [(b, a, b) for b in signed for a in signed]
+    ops = {
+        "INC": ("INC(%(a)d)", "%(a)d + 1", [(0, a, 0) for a in range(ARITH_MAX)]),
+        "DEC": ("DEC(%(a)d)", "%(a)d ? %(a)d - 1 : 0", [(0, a, 0) for a in full]),
+        "IS_ZERO": ("IS_ZERO(%(a)d)", "%(a)d == 0", [(0, a, 0) for a in full]),
+        "IS_ONE": ("IS_ONE(%(a)d)", "%(a)d == 1", [(0, a, 0) for a in full]),
+        "ADD": ("ADD(%(a)d, %(b)d)", "%(a)d + %(b)d", [(b, a, b) for b in full for a in full if a + b <= ARITH_MAX]),
+        "SUB": ("SUB(%(a)d, %(b)d)", "%(a)d > %(b)d ? %(a)d - %(b)d : 0", [(b, a, b) for b in full for a in full]),
+        "MUL": ("MUL(%(a)d, %(b)d)", "%(a)d * %(b)d", [(b, a, b) for b in full for a in full if a * b <= ARITH_MAX]),
+        "DIV": ("DIV(%(a)d, %(b)d)", "%(a)d / %(b)d", [(b, a, b) for b in full[1:] for a in full]),
+        "BINOM": ("BINOM(%(a)d, %(b)d)", "%(r)d",
+                  [(b, a, b) for b in full for a in full if binom_in_domain(a, b)]),
+        "CMP": ("CHECK_CMP(%(a)d, %(b)d)", "(%(a)d > %(b)d) - (%(a)d < %(b)d)", [(b, a, b) for b in full for a in full]),
+        "LESS": ("LESS(%(a)d, %(b)d)", "%(a)d < %(b)d", [(b, a, b) for b in full for a in full]),
+        "LESS_EQ": ("LESS_EQ(%(a)d, %(b)d)", "%(a)d <= %(b)d", [(b, a, b) for b in full for a in full]),
+        "GREATER": ("GREATER(%(a)d, %(b)d)", "%(a)d > %(b)d", [(b, a, b) for b in full for a in full]),
+        "GREATER_EQ": ("GREATER_EQ(%(a)d, %(b)d)", "%(a)d >= %(b)d", [(b, a, b) for b in full for a in full]),
+        "MIN": ("MIN(%(a)d, %(b)d)", "%(a)d < %(b)d ? %(a)d : %(b)d", [(b, a, b) for b in full for a in full]),
+        "MAX": ("MAX(%(a)d, %(b)d)", "%(a)d > %(b)d ? %(a)d : %(b)d", [(b, a, b) for b in full for a in full]),
+        "POPCOUNT": ("POPCOUNT(%(a)d)", "%(r)d", [(0, a, 0) for a in bits]),
+        "LOG2": ("LOG2(%(a)d)", "%(r)d", [(0, a, 0) for a in bits[1:]]),
+        "NEXT_POW2": ("NEXT_POW2(%(a)d)", "%(r)d", [(0, a, 0) for a in bits]),
+        "IS_POW2": ("IS_POW2(%(a)d)", "%(r)d", [(0, a, 0) for a in bits]),
+        "BITAND": ("BITAND(%(a)d, %(b)d)", "%(a)d & %(b)d", [(b, a, b) for b in bits for a in bits]),
+        "BITOR": ("BITOR(%(a)d, %(b)d)", "%(a)d | %(b)d", [(b, a, b) for b in bits for a in bits]),
+        "BITXOR": ("BITXOR(%(a)d, %(b)d)", "%(a)d ^ %(b)d", [(b, a, b) for b in bits for a in bits]),
+        "SHL": ("SHL(%(a)d, %(b)d)", "%(a)d << %(b)d", [(b, a, b) for b in range(9) for a in bits if a << b <= BITS_MAX]),
+        "SHR": ("SHR(%(a)d, %(b)d)", "%(a)d >> %(b)d", [(b, a, b) for b in range(9) for a in bits]),
+        "INT_NEG": ("INT_LITERAL(INT_NEG(%(sa)s))", "-(%(a)d)", [(0, a, 0) for a in signed]),
+        "INT_ABS": ("INT_ABS(%(sa)s)", "%(r)d", [(0, a, 0) for a in signed]),
+        "INT_ADD": ("INT_LITERAL(INT_ADD(%(sa)s, %(sb)s))", "(%(a)d) + (%(b)d)",
+                    [(b, a, b) for b in signed for a in signed if abs(a + b) <= ARITH_MAX]),
+        "INT_SUB": ("INT_LITERAL(INT_SUB(%(sa)s, %(sb)s))", "(%(a)d) - (%(b)d)",
+                    [(b, a, b) for b in signed for a in signed if abs(a - b) <= ARITH_MAX]),
+        "INT_CMP": ("CHECK_INT_CMP(%(sa)s, %(sb)s)", "((%(a)d) > (%(b)d)) - ((%(a)d) < (%(b)d))", pairs),
+        "INT_LESS": ("INT_LESS(%(sa)s, %(sb)s)", "(%(a)d) < (%(b)d)", pairs),
+        "INT_LESS_EQ": ("INT_LESS_EQ(%(sa)s, %(sb)s)", "(%(a)d) <= (%(b)d)", pairs),
+        "INT_GREATER": ("INT_GREATER(%(sa)s, %(sb)s)", "(%(a)d) > (%(b)d)", pairs),
+        "INT_GREATER_EQ": ("INT_GREATER_EQ(%(sa)s, %(sb)s)", "(%(a)d) >= (%(b)d)", pairs),
+        "INT_MIN": ("INT_LITERAL(INT_MIN(%(sa)s, %(sb)s))", "%(r)d", pairs),
+        "INT_MAX": ("INT_LITERAL(INT_MAX(%(sa)s, %(sb)s))", "%(r)d", pairs),
+    }
+    results = {  # the expected values C has no operator for
+        "BINOM": lambda a, b: binom(a, b),
+        "POPCOUNT": lambda a, b: bin(a).count("1"),
+        "LOG2": lambda a, b: a.bit_length() - 1,
+        "NEXT_POW2": lambda a, b: 1 << max(a - 1, 0).bit_length(),
+        "IS_POW2": lambda a, b: int(a != 0 and a & (a - 1) == 0),
+        "INT_ABS": lambda a, b: abs(a),
+        "INT_MIN": lambda a, b: min(a, b),
+        "INT_MAX": lambda a, b: max(a, b),
+    }
+    return ops, results
+
+
+def signed(n):
+    """Writes a signed operand the way mcmt/arith/signed.h reads it."""
+    return "NEG(%d)" % -n if n < 0 else "%d" % n
+
+
+def compile_row(cc, flags, lines, timeout):
+    """Compiles the checks of a row, returns (seconds, {line number: error})."""
+    with tempfile.TemporaryDirectory(prefix="mcmt_arith") as tmp:
+        probe = os.path.join(tmp, "probe.c")
+        with open(probe, "w") as f:
+            f.write(PRELUDE + "".join(line + "\n" for line in lines))
+        start = time.perf_counter()
+        proc = subprocess.run([cc, "-fsyntax-only", "-std=c11"] + flags + [probe],
+                              stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, timeout=timeout)
+        elapsed = time.perf_counter() - start
+    errors = {}
+    for m in ERROR_RE.finditer(proc.stderr.decode(errors="replace")):
+        errors.setdefault(int(m.group(1)), m.group(2))
+    if proc.returncode != 0 and not errors:
+        errors[0] = "exit code %d" % proc.returncode
+    return elapsed, errors
+
+
+def expand(cc, flags, exprs, timeout):
+    """Returns the expansion of each expression, to report what a failed check produced."""
+    with tempfile.TemporaryDirectory(prefix="mcmt_arith") as tmp:
+        probe = os.path.join(tmp, "probe.c")
+        with open(probe, "w") as f:
+            f.write(PRELUDE + "".join("__MCMT_CHECK__ %s\n" % e for e in exprs))
+        proc = subprocess.run([cc, "-E", "-P"] + flags + [probe], capture_output=True, timeout=timeout)
+    out = proc.stdout.decode(errors="replace").split("__MCMT_CHECK__")[1:]
+    return [" ".join(o.split()) for o in out] + ["?"] * (len(exprs) - len(out))
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("ops", nargs="*", help="the operations to check (default: all)")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="the compiler (default: $CC or cc)")
+    ap.add_argument("-j", "--jobs", type=int, default=os.cpu_count() or 1, help="parallel compilations")
+    ap.add_argument("--max", type=int, help="only operands up to this value in magnitude, for a quick run")
+    ap.add_argument("--timeout", type=float, default=600, help="seconds before a row is given up (default: 600)")
+    ap.add_argument("--failures", type=int, default=10, help="failures reported per operation (default: 10)")
+    ap.add_argument("--csv", help="write the cost map, one line per row, to this file")
+    ap.add_argument("--json", action="store_true", help="print the report as JSON")
+    opts, flags = ap.parse_known_args(argv)
+    flags = ["-I", ROOT] + [f for f in flags if f != "--"]
+
+    ops, results = table()
+    names = [n.upper() for n in opts.ops] or list(ops)
+    unknown = [n for n in names if n not in ops]
+    if unknown:
+        ap.error("unknown operations: %s (known: %s)" % (", ".join(unknown), " ".join(ops)))
+
+    jobs = []  # (op, row, cases)
+    for name in names:
+        rows = {}
+        for row, a, b in ops[name][2]:
+            if opts.max is None or max(abs(a), abs(b)) <= opts.max:
+                rows.setdefault(row, []).append((a, b))
+        jobs += [(name, row, cases) for row, cases in sorted(rows.items())]
+
+    first = PRELUDE.count("\n") + 1
+    base = min(compile_row(opts.cc, flags, [], opts.timeout)[0] for _ in range(3))
+    report = {name: {"cases": 0, "failed": [], "seconds": 0.0, "rows": []} for name in names}
+
+    def run(job):
+        name, row, cases = job
+        expr, want, _ = ops[name]
+        texts = []
+        for a, b in cases:
+            values = {"a": a, "b": b, "sa": signed(a), "sb": signed(b),
+                      "r": results[name](a, b) if name in results else 0}
+            texts.append((expr % values, "(" + want % values + ")"))
+        lines = ['_Static_assert(%s == %s, "%s");' % (e, w, e) for e, w in texts]
+        elapsed, errors = compile_row(opts.cc, flags, lines, opts.timeout)
+        failed = sorted({texts[n - first] for n in errors if 0 <= n - first < len(texts)})
+        if errors and not failed:
+            failed = [("row %d" % row, errors[min(errors)])]
+        return job, elapsed, failed
+
+    with concurrent.futures.ThreadPoolExecutor(max(opts.jobs, 1)) as pool:
+        for (name, row, cases), elapsed, failed in pool.map(run, jobs):
+            entry = report[name]
+            seconds = max(elapsed - base, 0.0)
+            entry["cases"] += len(cases)
+            entry["seconds"] += seconds
+            entry["failed"] += failed
+            entry["rows"].append({"row": row, "cases": len(cases), "seconds": seconds, "failed": len(failed)})
+
+    for name, entry in report.items():
+        shown = entry["failed"][: opts.failures]
+        got = expand(opts.cc, flags, [e for e, _ in shown], opts.timeout) if shown else []
+        entry["failed"] = [{"check": e, "expected": w, "got": g} for (e, w), g in zip(shown, got)] + (
+            [{"more": len(entry["failed"]) - len(shown)}] if len(entry["failed"]) > len(shown) else [])
+
+    if opts.csv:
+        with open(opts.csv, "w") as f:
+            f.write("op,row,cases,seconds,failed\n")
+            for name, entry in report.items():
+                for r in entry["rows"]:
+                    f.write("%s,%d,%d,%.6f,%d\n" % (name, r["row"], r["cases"], r["seconds"], r["failed"]))
+    ok = all(not e["failed"] for e in report.values())
+    if opts.json:
+        json.dump({"baseline_seconds": base, "operations": report}, sys.stdout, indent=2)
+        print()
+        return 0 if ok else 1
+
+    print("%-14s %8s %8s %10s %10s %13s" % ("operation", "cases", "failed", "time", "per case", "slowest row"))
+    for name, entry in report.items():
+        failed = sum(f.get("more", 1) for f in entry["failed"])
+        slowest = max(entry["rows"], key=lambda r: r["seconds"] / r["cases"], default=None)
+        print("%-14s %8d %8d %9.2fs %8.1fus %13s" % (
+            name, entry["cases"], failed, entry["seconds"], 1e6 * entry["seconds"] / max(entry["cases"], 1),
+            "-" if slowest is None else "%d: %.1fus" % (slowest["row"], 1e6 * slowest["seconds"] / slowest["cases"])))
+    for name, entry in report.items():
+        for f in entry["failed"]:
+            if "more" in f:
+                print("  %s: %d more failures" % (name, f["more"]))
+            else:
+                print("  %s is %s, expected %s" % (f["check"], f["got"], f["expected"]))
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,29 @@
+# CMake rules for tools/mcmt_bake.py.
+#
+#   include(path/to/macrometa/tools/mcmt_bake.cmake)
+#   mcmt_bake(app src/table.c FLAGS -I${CMAKE_SOURCE_DIR})
+#
+# regenerates src/table.bake.h, which src/table.c includes, before `app` is compiled, and again whenever the source or
+# one of the headers it includes changes, so a cached expansion cannot go stale. The compiler is the C compiler of the
+# project, and FLAGS are the preprocessing flags of the source. The dependency file of the rule needs CMake 3.20 with
+# the Makefile generators.
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+set(MCMT_BAKE_TOOL "${CMAKE_CURRENT_LIST_DIR}/mcmt_bake.py")
+
+function(mcmt_bake _target _source)
+    cmake_parse_arguments(PARSE_ARGV 2 _bake "" "" "FLAGS")
+    get_filename_component(_source "${_source}" ABSOLUTE)
+    get_filename_component(_dir "${_source}" DIRECTORY)
+    get_filename_component(_stem "${_source}" NAME_WLE)
+    set(_header "${_dir}/${_stem}.bake.h")
+    add_custom_command(
+        OUTPUT "${_header}"
+        COMMAND Python3::Interpreter "${MCMT_BAKE_TOOL}" --cc "${CMAKE_C_COMPILER}" --depfile "${_header}.d"
+                -o "${_header}" "${_source}" -- ${_bake_FLAGS}
+        DEPENDS "${_source}" "${MCMT_BAKE_TOOL}"
+        DEPFILE "${_header}.d"
+        COMMENT "Baking the MCMT invocations of ${_stem}"
+        VERBATIM)
+    target_sources(${_target} PRIVATE "${_header}")
+endfunction()
@@ -0,0 +1,31 @@
+# GNU make rules for tools/mcmt_bake.py.
+#
+# Set MCMT_BAKE_SOURCES to the sources holding MCMT_BAKE invocations, each including its <stem>.bake.h, then include
+# this file. Every <stem>.bake.h is regenerated before the object of its source is compiled, and again whenever the
+# source or one of the headers it includes changes, so a cached expansion cannot go stale. The compiler and flags are
+# $(CC) and $(CPPFLAGS), as for the objects:
+#
+#   MCMT_BAKE_SOURCES := src/table.c
+#   include path/to/macrometa/tools/mcmt_bake.mk
+#
+# `make mcmt-bake-check` fails when a generated header is out of date, e.g. in a CI job over committed headers.
+
+ifndef MCMT_DIR
+MCMT_DIR := $(abspath $(dir $(lastword $(MAKEFILE_LIST)))..)
+endif
+MCMT_BAKE ?= $(MCMT_DIR)/tools/mcmt_bake.py
+MCMT_BAKE_HEADERS := $(MCMT_BAKE_SOURCES:.c=.bake.h)
+
+$(MCMT_BAKE_HEADERS): %.bake.h: %.c $(MCMT_BAKE)
+	$(MCMT_BAKE) --cc "$(CC)" --depfile $@.d -o $@ $< -- $(CPPFLAGS)
+
+# the header must exist before the first compilation of its source
+$(MCMT_BAKE_SOURCES:.c=.o): %.o: %.bake.h
+
+-include $(MCMT_BAKE_HEADERS:=.d)
+
+.PHONY: mcmt-bake-check
+mcmt-bake-check:
+	@status=0; for src in $(MCMT_BAKE_SOURCES); do \
+	    $(MCMT_BAKE) --cc "$(CC)" --check $$src -- $(CPPFLAGS) || status=1; \
+	done; exit $$status
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""Offline pre-expansion cache for macrometa (MCMT).
+
+Expands the `MCMT_BAKE(key, ...)` invocations of a source file once with the local preprocessor and writes their
+expansions to a generated header. When that header is included before the invocations, `MCMT_BAKE` substitutes the
+cached expansion and the preprocessor skips the invocation entirely, so expensive constant invocations (`BINOM`,
+`FOR_EACH` over fixed lists, ...) are no longer re-expanded in every build of every translation unit.
+
+Each entry of the header is keyed by a content hash of the invocation, of the preprocessing directives that precede
+it, of the compiler and flags, and of every header the source depends on, the MCMT headers included. Rerunning the
+tool re-expands only the entries whose hash changed and leaves the header untouched when nothing did, so it is meant to
+run as a pre-build step of the source, before every compilation. `--depfile` also writes the source and its headers as
+a make rule of the generated header, which tools/mcmt_bake.mk and tools/mcmt_bake.cmake use to rerun the tool whenever
+one of them changes.
+
+Usage:
+    tools/mcmt_bake.py [options] file.c [-- compiler flags]
+
+For example, with `#include "table.bake.h"` after the MCMT headers in src/table.c:
+    tools/mcmt_bake.py src/table.c -- -I.
+"""
+
+import argparse
+import hashlib
+import os
+import re
+import shlex
+import sys
+import tempfile
+
+from mcmt_prof import CompileError, find_sites, probe_source, run_cc
+
+SITE_MARK = "__MCMT_BAKE_SITE__"
+ENTRY_RE = re.compile(r"^/\* (\w+) ([0-9a-f]{16}) \*/\n#define __MCMT_BAKED_HIT_\1 .*\n(#define __MCMT_BAKED_\1 .*)\n",
+                      re.M)
+KEY_RE = re.compile(r"^[A-Za-z_]\w*$")
+
+
+def split_args(text):
+    """Splits `MCMT_BAKE(key, ...)` into the key and the invocation, skipping parentheses in literals."""
+    inner = text[text.index("(") + 1 : text.rindex(")")]
+    level, i = 0, 0
+    while i < len(inner):
+        c = inner[i]
+        if c in "\"'":
+            i += 1
+            while i < len(inner) and inner[i] != c:
+                i += 2 if inner[i] == "\\" else 1
+        elif c == "(":
+            level += 1
+        elif c == ")":
+            level -= 1
+        elif c == "," and level == 0:
+            return inner[:i].strip(), inner[i + 1 :].strip()
+        i += 1
+    return inner.strip(), ""
+
+
+def dependencies(cc, flags, path, output):
+    """Returns the headers the source includes, except the generated one. The source itself is hashed per site."""
+    _, out, _ = run_cc(cc, ["-M", "-MG"] + flags + [path], 600)
+    names = re.split(r"(?<!\\)\s+", out.replace("\\\n", " ").split(":", 1)[1])
+    deps = {os.path.abspath(n.replace("\\ ", " ")) for n in names if n}
+    return sorted(d for d in deps if os.path.isfile(d) and d not in (path, output))
+
+
+def write_depfile(depfile, output, deps):
+    """Writes `output: deps` as a make rule, with an empty rule per header so that a removed one is not an error.
+    The header is named as on the command line, which is how the build tool running the rule names it."""
+    quote = lambda p: p.replace(" ", "\\ ")
+    with open(depfile, "w", encoding="utf-8") as f:
+        f.write("%s: %s\n" % (quote(output), " \\\n  ".join(quote(d) for d in deps)))
+        f.writelines("\n%s:\n" % quote(d) for d in deps[1:])
+
+
+def digest(*parts):
+    h = hashlib.sha256()
+    for part in parts:
+        h.update(part.encode() if isinstance(part, str) else part)
+        h.update(b"\0")
+    return h.hexdigest()[:16]
+
+
+def expand(cc, flags, site, text, timeout):
+    """Preprocesses the invocation after the directives that precede it, returns its expansion on one line."""
+    with tempfile.TemporaryDirectory(prefix="mcmt_bake") as tmp:
+        probe = os.path.join(tmp, "probe.c")
+        with open(probe, "w") as f:
+            f.write(probe_source(site.prelude, site.depth, SITE_MARK + "\n" + text))
+        try:
+            _, out, _ = run_cc(cc, ["-E", "-P"] + flags + [probe], timeout)
+        except CompileError as e:  # a location in the probe is reported as the site instead
+            raise CompileError(e.message, None if e.location and e.location.startswith(probe) else e.location)
+    out = out.split(SITE_MARK, 1)[1]
+    words = []
+    for line in out.splitlines():
+        line = line.strip()
+        if line.startswith("#pragma "):  # from _Pragma, which a #define must keep as an operator
+            line = "_Pragma(\"%s\")" % line[len("#pragma ") :].replace("\\", "\\\\").replace('"', '\\"')
+        if line:
+            words.append(line)
+    return " ".join(words)
+
+
+def guard(output):
+    return "MCMT_BAKE_%s_H" % re.sub(r"\W", "_", os.path.basename(output).split(".")[0]).upper()
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("file", help="the source file holding MCMT_BAKE invocations")
+    ap.add_argument("flags", nargs="*", help="compiler flags, after `--`")
+    ap.add_argument("-o", "--output", help="the generated header (default: <file stem>.bake.h next to the file)")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="the compiler (default: $CC or cc)")
+    ap.add_argument("--timeout", type=float, default=600, help="seconds before an invocation is given up (default: 600)")
+    ap.add_argument("--check", action="store_true", help="write nothing, exit with 1 if the header is out of date")
+    ap.add_argument("--depfile", help="also write the source and its headers as a make rule of the header")
+    ap.add_argument("-v", "--verbose", action="store_true", help="report every entry")
+    opts = ap.parse_args(argv)
+
+    path = os.path.abspath(opts.file)
+    output = os.path.abspath(opts.output or os.path.splitext(path)[0] + ".bake.h")
+    flags = ["-iquote", os.path.dirname(path), "-DMCMT_BAKE_DISABLE"] + opts.flags
+    with open(path, encoding="utf-8", errors="replace") as f:
+        src = f.read()
+    old = ""
+    if os.path.exists(output):
+        with open(output, encoding="utf-8") as f:
+            old = f.read()
+    elif not opts.check:
+        open(output, "w").close()  # so that the source preprocesses before the first bake
+    cached = {m.group(1): (m.group(2), m.group(3)) for m in ENTRY_RE.finditer(old)}
+
+    inputs, deps = [opts.cc] + opts.flags, dependencies(opts.cc, flags, path, output)
+    for dep in deps:
+        with open(dep, "rb") as f:
+            inputs += [dep, f.read()]
+    base = digest(*inputs)
+
+    entries, texts, baked = [], {}, 0
+    for site in find_sites(src, {"MCMT_BAKE"}):
+        key, text = split_args(site.text)
+        where = "%s:%d" % (opts.file, site.line)
+        if not KEY_RE.match(key):
+            sys.exit("%s: the key of MCMT_BAKE must be an identifier, got `%s`" % (where, key))
+        if key in texts:
+            if texts[key] != " ".join(text.split()):
+                sys.exit("%s: the key `%s` is already used for another invocation" % (where, key))
+            continue
+        texts[key] = " ".join(text.split())
+        hashed = digest(base, "\n".join(site.prelude), str(site.depth), texts[key])
+        if key in cached and cached[key][0] == hashed:
+            define = cached[key][1]
+        else:
+            try:
+                define = "#define __MCMT_BAKED_%s %s" % (key, expand(opts.cc, flags, site, text, opts.timeout))
+            except (RuntimeError, TimeoutError) as e:
+                sys.exit("%s: cannot expand `%s`: %s" % (where, key, e))
+            baked += 1
+            if opts.verbose:
+                print("%s: baked %s" % (where, key))
+        entries.append("/* %s %s */\n#define __MCMT_BAKED_HIT_%s PROBE()\n%s\n" % (key, hashed, key, define))
+
+    header = "".join(
+        ["/* Generated by tools/mcmt_bake.py from %s, do not edit. */\n" % os.path.basename(path),
+         "/* %s */\n" % " ".join(shlex.quote(a) for a in ["tools/mcmt_bake.py", opts.file, "--"] + opts.flags),
+         "#ifndef %s\n#define %s\n\n" % (guard(output), guard(output))]
+        + entries
+        + ["\n#endif // !%s\n" % guard(output)]
+    )
+    if opts.depfile and not opts.check:
+        write_depfile(opts.depfile, opts.output or os.path.splitext(opts.file)[0] + ".bake.h", [path] + deps)
+    if header == old:
+        if opts.depfile and not opts.check:  # newer than its inputs, so that the build does not run the tool again
+            os.utime(output)
+        if opts.verbose:
+            print("%s: %d entries up to date" % (os.path.relpath(output), len(entries)))
+        return 0
+    if opts.check:
+        print("%s: out of date" % os.path.relpath(output))
+        return 1
+    with open(output, "w", encoding="utf-8") as f:
+        f.write(header)
+    print("%s: %d entries, %d baked" % (os.path.relpath(output), len(entries), baked))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Size of the _DECLARE and _DEFINE forms of the macrometa (MCMT) generators.
+
+Expands one sample invocation of every generator of `mcmt/gen` that comes in a `_DECLARE` / `_DEFINE` pair, in each
+of its three forms, and reports what each form adds to a translation unit over the bare includes: the preprocessed
+size in bytes and the time to compile it with `-fsyntax-only`. The default form is what every translation unit
+including a generated header pays; the `_DECLARE` form is what it pays instead, and the `_DEFINE` form is paid once.
+
+The pairs are also built into a small program, a header of `_DECLARE` forms included by two translation units, one of
+which holds the `_DEFINE` forms, which must compile without warnings under `-Wall -Wextra` and link.
+
+Usage:
+    tools/mcmt_declare_size.py [options] [-- compiler flags]
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+from mcmt_prof import run_cc
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+PRELUDE = """#include <stdint.h>
+#include "macrometa.h"
+static inline uint64_t u32_hash(uint32_t k) { return (uint64_t)k * 0x9E3779B97F4A7C15ull; }
+#define U32_EQ(_a, _b) ((_a) == (_b))
+#define NUM_RULES (start, digit, integer, ), (integer, digit, integer, ), (integer, point, fraction, ), \\
+    (fraction, digit, fraction, )
+"""
+
+# the generator, its arguments, and the arguments only its _DEFINE form takes
+SAMPLES = [
+    ("SOA_STRUCT", "Particles, (float, x), (float, y), (float, z), (unsigned, id)", None),
+    ("SPLIT_STRUCT", "Order, (HOT, double, price), (HOT, unsigned, qty), (COLD, long, created_at), (COLD, int, flags)",
+     None),
+    ("BITPACK", "Key, (12, tenant), (10, shard), (42, seq)", None),
+    ("REFLECT_ENUM", "Method, GET, HEAD, POST, PUT, DELETE, OPTIONS", None),
+    ("KEYWORD_MATCHER", "verb, GET, HEAD, POST, PUT, DELETE, OPTIONS", None),
+    ("FLAT_MAP", "IdMap, uint32_t, double", "u32_hash, U32_EQ"),
+    ("REGISTRY", "Metric, requests, errors, latency_us", None),
+    ("STATE_MACHINE", "num, (start, integer, fraction), (digit, point, other), NUM_RULES", None),
+]
+
+
+def forms(name, args, extra):
+    """Returns the invocations of the default, _DECLARE and _DEFINE forms of a generator."""
+    full = args + (", " + extra if extra else "")
+    return "%s(%s)\n" % (name, full), "%s_DECLARE(%s)\n" % (name, args), "%s_DEFINE(%s)\n" % (name, full)
+
+
+def measure(cc, flags, tmp, body, repeat, timeout):
+    """Returns the preprocessed size and the fastest -fsyntax-only time of the prelude followed by `body`."""
+    src = os.path.join(tmp, "probe.c")
+    with open(src, "w") as f:
+        f.write(PRELUDE + body)
+    _, out, _ = run_cc(cc, ["-E", "-P"] + flags + [src], timeout)
+    seconds = min(run_cc(cc, ["-fsyntax-only"] + flags + [src], timeout)[0] for _ in range(repeat))
+    return len(out.encode()), seconds
+
+
+def link_check(cc, flags, tmp, timeout):
+    """Builds a header of _DECLARE forms into two translation units, one holding the _DEFINE forms, and links them."""
+    header = "".join(forms(*s)[1] for s in SAMPLES)
+    files = {
+        "gen.h": "#ifndef GEN_H\n#define GEN_H\n" + PRELUDE + header + "#endif\n",
+        "gen.c": '#include "gen.h"\n' + "".join(forms(*s)[2] for s in SAMPLES),
+        "main.c": '#include "gen.h"\nint main(void) {\n    Method m;\n'
+                  '    return !(Method_from_string("POST", 4, &m) && verb("PUT", 3) == verb_PUT\n'
+                  '             && num_step(num_start, num_class_digit) == num_integer && Metric_names[Metric_errors]);\n}\n',
+    }
+    for name, text in files.items():
+        with open(os.path.join(tmp, name), "w") as f:
+            f.write(text)
+    exe = os.path.join(tmp, "main")
+    run_cc(cc, ["-Wall", "-Wextra", "-Werror", "-Wno-unknown-pragmas"] + flags
+           + [os.path.join(tmp, "gen.c"), os.path.join(tmp, "main.c"), "-o", exe], timeout)
+    return subprocess.run([exe]).returncode == 0
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="the compiler (default: $CC or cc)")
+    ap.add_argument("--repeat", type=int, default=3, help="compilations per form, the fastest is kept (default: 3)")
+    ap.add_argument("--timeout", type=float, default=120, help="seconds before a form is given up (default: 120)")
+    opts, flags = ap.parse_known_args(argv)
+    flags = ["-std=c11", "-I", ROOT] + [f for f in flags if f != "--"]
+
+    with tempfile.TemporaryDirectory(prefix="mcmt_declare") as tmp:
+        base_bytes, base_seconds = measure(opts.cc, flags, tmp, "", opts.repeat, opts.timeout)
+        print("bare includes: %d bytes, %.2fms (%s)\n" % (base_bytes, base_seconds * 1e3, " ".join([opts.cc] + flags)))
+        print("%-16s %11s %11s %11s %10s %10s %10s" % ("generator", "default", "_DECLARE", "_DEFINE", "default",
+                                                       "_DECLARE", "_DEFINE"))
+        totals = [0] * 6
+        for sample in SAMPLES:
+            default, declare, define = forms(*sample)
+            row = []
+            for body in (default, declare, declare + define):
+                row.append(measure(opts.cc, flags, tmp, body, opts.repeat, opts.timeout))
+            sizes = [row[0][0] - base_bytes, row[1][0] - base_bytes, row[2][0] - row[1][0]]
+            times = [row[0][1] - base_seconds, row[1][1] - base_seconds, row[2][1] - row[1][1]]
+            cells = sizes + [max(t, 0.0) * 1e3 for t in times]
+            totals = [a + b for a, b in zip(totals, cells)]
+            print("%-16s %5d bytes %5d bytes %5d bytes %8.2fms %8.2fms %8.2fms" % ((sample[0],) + tuple(cells)))
+        print("%-16s %5d bytes %5d bytes %5d bytes %8.2fms %8.2fms %8.2fms" % (("total",) + tuple(totals)))
+        linked = link_check(opts.cc, flags, tmp, opts.timeout)
+    print("\n_DECLARE header + _DEFINE source: %s" % ("links and runs" if linked else "FAILED"))
+    return 0 if linked else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
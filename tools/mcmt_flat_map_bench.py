@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+"""Micro-benchmark of the FLAT_MAP hash map of macrometa (MCMT).
+
+Builds a small C program that runs the same workload on a map generated by `FLAT_MAP` and on a textbook
+chained hash map (one heap node per entry, buckets doubled at load factor 1), and reports the time per operation of
+each phase: inserting N distinct keys, finding them all, finding N absent keys, and erasing half of them, then
+finding all N keys again. Both maps must agree on the sum of the values they find, so the run doubles as a check.
+
+Keys are 32-bit integers, hashed with a multiplicative hash; `--collide` hashes them into a handful of values instead,
+the worst case of both maps.
+
+Usage:
+    tools/mcmt_flat_map_bench.py [options] [-- compiler flags]
+
+For example:
+    tools/mcmt_flat_map_bench.py -n 1000000 -- -O3 -march=native
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+PROGRAM = r"""
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mcmt/gen/flat_map.h"
+
+#if COLLIDE
+#    define KEY_HASH(_k) ((uint64_t)((_k) & 7) * 0x9E3779B97F4A7C15ull)
+#else
+#    define KEY_HASH(_k) ((uint64_t)(_k) * 0x9E3779B97F4A7C15ull)
+#endif
+#define KEY_EQ(_a, _b) ((_a) == (_b))
+
+FLAT_MAP(FlatMap, uint32_t, uint64_t, KEY_HASH, KEY_EQ)
+
+typedef struct Node {
+    struct Node* next;
+    uint32_t     key;
+    uint64_t     val;
+} Node;
+typedef struct {
+    Node** buckets;
+    size_t len;
+    size_t cap;
+} ChainMap;
+
+static void chain_grow(ChainMap* m) {
+    size_t cap = m->cap ? m->cap * 2 : 16;
+    Node** buckets = calloc(cap, sizeof(Node*));
+    for (size_t b = 0; b < m->cap; ++b) {
+        for (Node *n = m->buckets[b], *next; n; n = next) {
+            next = n->next;
+            n->next = buckets[KEY_HASH(n->key) & (cap - 1)];
+            buckets[KEY_HASH(n->key) & (cap - 1)] = n;
+        }
+    }
+    free(m->buckets);
+    m->buckets = buckets;
+    m->cap = cap;
+}
+static uint64_t* chain_find(ChainMap* m, uint32_t key) {
+    if (!m->cap) { return NULL; }
+    for (Node* n = m->buckets[KEY_HASH(key) & (m->cap - 1)]; n; n = n->next) {
+        if (n->key == key) { return &n->val; }
+    }
+    return NULL;
+}
+static void chain_insert(ChainMap* m, uint32_t key, uint64_t val) {
+    uint64_t* slot = chain_find(m, key);
+    if (slot) { *slot = val; return; }
+    if (m->len >= m->cap) { chain_grow(m); }
+    Node* n = malloc(sizeof(Node));
+    n->key = key;
+    n->val = val;
+    n->next = m->buckets[KEY_HASH(key) & (m->cap - 1)];
+    m->buckets[KEY_HASH(key) & (m->cap - 1)] = n;
+    m->len += 1;
+}
+static void chain_erase(ChainMap* m, uint32_t key) {
+    if (!m->cap) { return; }
+    for (Node** p = &m->buckets[KEY_HASH(key) & (m->cap - 1)]; *p; p = &(*p)->next) {
+        if ((*p)->key == key) {
+            Node* n = *p;
+            *p = n->next;
+            free(n);
+            m->len -= 1;
+            return;
+        }
+    }
+}
+static void chain_fini(ChainMap* m) {
+    for (size_t b = 0; b < m->cap; ++b) {
+        for (Node *n = m->buckets[b], *next; n; n = next) {
+            next = n->next;
+            free(n);
+        }
+    }
+    free(m->buckets);
+}
+
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+/* keys are spread over the 32-bit range by an odd multiplier, so they are distinct and in no particular order */
+#define KEY(_i) ((uint32_t)((_i) * 2654435761u))
+
+#define PHASE(_map, _name, _count, _body)                                   \
+    do {                                                                    \
+        double start = now();                                               \
+        for (uint32_t i = 0; i < (_count); ++i) { _body; }                  \
+        printf("%s %s %.2f\n", _map, _name, (now() - start) * 1e9 / (_count)); \
+    } while (0)
+
+int main(void) {
+    const uint32_t n = N;
+    uint64_t sums[2] = { 0, 0 };
+    FlatMap flat;
+    ChainMap chain = { 0 };
+    FlatMap_init(&flat);
+    PHASE("flat", "insert", n, FlatMap_insert(&flat, KEY(i), i));
+    PHASE("flat", "find_hit", n, { uint64_t* v = FlatMap_find(&flat, KEY(i)); sums[0] += v ? *v : 0; });
+    PHASE("flat", "find_miss", n, sums[0] += FlatMap_find(&flat, KEY(n + i)) != NULL);
+    PHASE("flat", "erase", n / 2, FlatMap_erase(&flat, KEY(2 * i)));
+    PHASE("flat", "find_after", n, { uint64_t* v = FlatMap_find(&flat, KEY(i)); sums[0] += v ? *v : 0; });
+    PHASE("chain", "insert", n, chain_insert(&chain, KEY(i), i));
+    PHASE("chain", "find_hit", n, { uint64_t* v = chain_find(&chain, KEY(i)); sums[1] += v ? *v : 0; });
+    PHASE("chain", "find_miss", n, sums[1] += chain_find(&chain, KEY(n + i)) != NULL);
+    PHASE("chain", "erase", n / 2, chain_erase(&chain, KEY(2 * i)));
+    PHASE("chain", "find_after", n, { uint64_t* v = chain_find(&chain, KEY(i)); sums[1] += v ? *v : 0; });
+    printf("sum %llu %llu\n", (unsigned long long)sums[0], (unsigned long long)sums[1]);
+    FlatMap_fini(&flat);
+    chain_fini(&chain);
+    return sums[0] != sums[1];
+}
+"""
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="the compiler (default: $CC or cc)")
+    ap.add_argument("-n", type=int, default=200000, help="keys per phase (default: 200000)")
+    ap.add_argument("--collide", action="store_true", help="hash the keys into 8 values only")
+    opts, flags = ap.parse_known_args(argv)
+    flags = [f for f in flags if f != "--"] or ["-O2"]
+    if opts.collide and opts.n > 20000:
+        opts.n = 20000  # every operation walks a run of n / 8 keys
+
+    with tempfile.TemporaryDirectory(prefix="mcmt_flat_map") as tmp:
+        src, exe = os.path.join(tmp, "bench.c"), os.path.join(tmp, "bench")
+        with open(src, "w") as f:
+            f.write(PROGRAM)
+        defines = ["-DN=%d" % opts.n, "-DCOLLIDE=%d" % opts.collide]
+        subprocess.run([opts.cc, "-std=c11", "-I", ROOT] + defines + flags + [src, "-o", exe], check=True)
+        out = subprocess.run([exe], stdout=subprocess.PIPE, universal_newlines=True).stdout
+
+    times, sums = {}, None
+    for line in out.splitlines():
+        fields = line.split()
+        if fields[0] == "sum":
+            sums = fields[1:]
+        else:
+            times.setdefault(fields[1], {})[fields[0]] = float(fields[2])
+    print("%d keys, %s, %s\n" % (opts.n, "colliding hash" if opts.collide else "multiplicative hash",
+                                 " ".join([opts.cc] + flags)))
+    print("%-12s %10s %10s %8s" % ("phase", "flat", "chained", "speedup"))
+    for phase, row in times.items():
+        print("%-12s %8.1fns %8.1fns %7.2fx" % (phase, row["flat"], row["chain"], row["chain"] / max(row["flat"], 1e-9)))
+    if not sums or sums[0] != sums[1]:
+        print("\nthe maps disagree: %s" % (" != ".join(sums) if sums else "no result"))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Parse cost of the macrometa (MCMT) headers.
+
+Preprocesses a translation unit that includes nothing but one header, for every header of the library, and reports
+what including it costs: the preprocessing time of one inclusion, the number of macros it defines with its
+dependencies, and the headers it pulls in. This is what a translation unit pays before invoking anything, so it
+shows which header to include instead of `macrometa.h` when only a few macros are needed.
+
+Usage:
+    tools/mcmt_header_cost.py [options] [header ...] [-- compiler flags]
+
+Headers are paths relative to the repository root and default to every header of the library. For example:
+    tools/mcmt_header_cost.py mcmt/concat.h mcmt/arg.h mcmt/for_each.h
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+import tempfile
+
+from mcmt_prof import run_cc
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+GUARD_RE = re.compile(r"^#ifndef (\w+)\n#define \1$", re.M)
+
+
+def includes_of(cc, flags, header, timeout):
+    """Returns the headers of the repository that a translation unit including `header` reads, `header` first."""
+    with tempfile.TemporaryDirectory(prefix="mcmt_cost") as tmp:
+        probe = os.path.join(tmp, "probe.c")
+        with open(probe, "w") as f:
+            f.write('#include "%s"\n' % header)
+        _, deps, _ = run_cc(cc, ["-M"] + flags + [probe], timeout)
+    names = deps.replace("\\\n", " ").split(":", 1)[1].split()
+    paths = [os.path.abspath(n) for n in names if os.path.abspath(n).startswith(ROOT + os.sep)]
+    return sorted(set(paths), key=paths.index)  # a header re-entered through a dependency cycle is listed again
+
+
+def cost(cc, flags, header, guards, copies, repeat, timeout):
+    """Returns the fastest time to preprocess `copies` inclusions of `header`, and the number of macros defined.
+    The include guards are undefined between two inclusions, so each of them parses the header and its dependencies
+    again, and the cost of one inclusion stands out from the startup time of the compiler."""
+    with tempfile.TemporaryDirectory(prefix="mcmt_cost") as tmp:
+        probe = os.path.join(tmp, "probe.c")
+        with open(probe, "w") as f:
+            for _ in range(copies if header else 0):
+                f.write('#include "%s"\n' % header)
+                f.writelines("#undef %s\n" % g for g in guards)
+        best = min(run_cc(cc, ["-E", "-P"] + flags + [probe], timeout)[0] for _ in range(repeat))
+        _, defines, _ = run_cc(cc, ["-E", "-dM"] + flags + [probe], timeout)
+    return best, sum(1 for line in defines.splitlines() if line.startswith("#define "))
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("headers", nargs="*", help="the headers to measure (default: all)")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="the compiler (default: $CC or cc)")
+    ap.add_argument("--copies", type=int, default=20, help="inclusions per run (default: 20)")
+    ap.add_argument("--repeat", type=int, default=5, help="runs per header, the fastest is kept (default: 5)")
+    ap.add_argument("--timeout", type=float, default=120, help="seconds before a header is given up (default: 120)")
+    ap.add_argument("--json", action="store_true", help="print the report as JSON")
+    opts, flags = ap.parse_known_args(argv)
+    flags = [f for f in flags if f != "--"]
+
+    headers = opts.headers or ["macrometa.h"] + sorted(
+        os.path.relpath(p, ROOT) for p in glob.glob(os.path.join(ROOT, "mcmt", "**", "*.h"), recursive=True)
+    )
+    flags = ["-I", ROOT] + flags
+    base, builtin = cost(opts.cc, flags, None, [], 0, opts.repeat, opts.timeout)  # the compiler's own macros
+
+    rows = []
+    for header in headers:
+        header = header.replace("\\", "/")
+        includes = includes_of(opts.cc, flags, header, opts.timeout)
+        guards = []
+        for path in includes:
+            with open(path, encoding="utf-8", errors="replace") as f:
+                guard = GUARD_RE.search(f.read())
+            if guard:
+                guards.append(guard.group(1))
+        seconds, defines = cost(opts.cc, flags, header, guards, opts.copies, opts.repeat, opts.timeout)
+        rows.append({"header": header, "seconds": max(seconds - base, 0.0) / opts.copies,
+                     "macros": max(defines - builtin, 0),
+                     "includes": sorted(os.path.relpath(p, ROOT) for p in includes[1:])})
+
+    if opts.json:
+        json.dump({"baseline_seconds": base, "headers": rows}, sys.stdout, indent=2)
+        print()
+        return 0
+    print("empty translation unit: %.2fms (%s)\n" % (base * 1e3, " ".join([opts.cc] + flags)))
+    print("%-26s %9s %8s %9s" % ("header", "time", "macros", "includes"))
+    for row in rows:
+        print("%-26s %7.2fms %8d %9d" % (row["header"], row["seconds"] * 1e3, row["macros"], len(row["includes"])))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""Cross-preprocessor conformance and performance matrix for macrometa (MCMT).
+
+Runs the same inputs under every preprocessor installed locally (GCC, Clang, TCC and mcpp by default) and reports,
+for each family of macros, whether the expansions match the expected tokens and how long a representative workload
+takes to preprocess, the cost of including the library subtracted. A preprocessor on which MCMT selects a fast path
+(see mcmt/pp.h) is also run with the fast paths turned off, so the matrix shows what each one gains, and whether
+a construct is pathologically slow on a preprocessor that does not get a fast path for it. GCC and Clang are also run
+with `MCMT_TRACE=2`, whose breadcrumbs must leave every expansion unchanged (see mcmt/recur.h).
+
+Preprocessors missing from the PATH are skipped. Outputs are compared token by token, so preprocessors that space
+their output differently still match.
+
+Usage:
+    tools/mcmt_pp_matrix.py [options] [family ...]
+
+For example, comparing the list engines of the local GCC with a TCC cross toolchain:
+    tools/mcmt_pp_matrix.py --pp "tcc-arm=arm-none-eabi-tcc -E -P" for_each list
+"""
+
+import argparse
+import json
+import os
+import shlex
+import shutil
+import sys
+import tempfile
+
+from mcmt_prof import TOKEN_RE, run_cc
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+CASE_MARK = "__MCMT_CASE__"
+PREPROCESSORS = [  # name, command preprocessing the file appended to it to stdout, without line markers
+    ("gcc", ["gcc", "-E", "-P", "-std=c11"]),
+    ("clang", ["clang", "-E", "-P", "-std=c11"]),
+    ("tcc", ["tcc", "-E", "-P"]),
+    ("mcpp", ["mcpp", "-P", "-V199901L"]),
+]
+PORTABLE = ["-DMCMT_PP_VA_OPT=0"]  # the flags turning every fast path of mcmt/pp.h off
+TRACE = ["-DMCMT_TRACE=2"]  # the flags turning every breadcrumb of mcmt/recur.h on
+TRACED = ("gcc", "clang")  # the MCMT_PP_NAME of the preprocessors handling the `GCC warning` of a breadcrumb
+PRELUDE = """#include "mcmt/mcmt.h"
+#define F(_x)        [_x]
+#define G(_p, _x)    _p##_x
+#define H(_i, _x)    _x = _i
+#define PAIR(_a, _b) _a:_b
+#define D_red        DICT_VALUE(0xff0000)
+#define D_pair       DICT_VALUE(a, b)
+#define S_simd       SET_MEMBER()
+#define RED          red
+"""
+LIST = ", ".join("a%d" % i for i in range(100))
+TUPLES = ", ".join("(%d, t%d)" % ((i * 7) % 12, i) for i in range(12))
+
+# family: (cases as (invocation, expected expansion), workload line, repetitions of the workload line)
+FAMILIES = {
+    "concat": ([("CONCAT(ab, cd)", "abcd"), ("CONCAT3(a, b, c)", "abc"), ("CAT(a, b)", "ab"), ("EXPAND(1 2)", "1 2")],
+               "CONCAT(a, b) CONCAT3(a, b, c) CAT(a, b)", 2000),
+    "arg": ([("COUNT(a)", "1"), ("COUNT(a, b, c, d, e, f, g, h, i, j)", "10"), ("COUNT_OPT()", "0"),
+             ("COUNT_OPT(a, b)", "2"), ("SND(a, b, c)", "b"), ("FST_REST(a, b, c)", "b, c")],
+            "COUNT(%s)" % LIST, 50),
+    "logic": ([("IF(1)(yes, no)", "yes"), ("IF(0)(yes, no)", "no"), ("AND(1, 0) OR(1, 0) XOR(1, 1)", "0 1 0"),
+               ("NOT(0) BOOL(7) BOOL(0)", "1 1 0"), ("IS_ZERO(0) IS_ONE(1) IS_ONE(2)", "1 1 0"),
+               ("IF_LAZY(1)(FST, SND)(a, b)", "a")],
+              "IF(AND(1, OR(0, 1)))(a, b) IS_ONE(1) BOOL(3)", 2000),
+    "list": ([("IS_EMPTY()", "1"), ("IS_EMPTY(a)", "0"), ("IS_EMPTY(a b)", "0"), ("IS_EMPTY((a), b)", "0"),
+              ("IS_EMPTY(())", "0"), ("IS_EMPTY(, b)", "0"), ("IS_EMPTY(a, )", "0"), ("IS_EMPTY(EMPTY())", "1"),
+              ("IS_EMPTY(DEFER(EMPTY)())", "1"), ("IS_NOT_EMPTY() IS_NOT_EMPTY(x)", "0 1"),
+              ("LIST_HEAD(a, b) LIST_TAIL(a, b, c)", "a b, c")],
+             "IS_EMPTY(a, b) IS_EMPTY() IS_NOT_EMPTY((a), b)", 2000),
+    "tuple": ([("IS_ENCLOSED((a)) IS_ENCLOSED(a)", "1 0"), ("UNCLOSE((a, b))", "a, b"),
+               ("UNCLOSE_OPT((a, b)) UNCLOSE_OPT(c)", "a, b c")],
+              "IS_ENCLOSED((a, b)) UNCLOSE_OPT((a)) UNCLOSE_OPT(b)", 2000),
+    "for_each": ([("FOR_EACH(F, a, b, c)", "[a] [b] [c]"), ("FOR_EACH(F)", ""),
+                  ("FOR_EACH_WITH(G, p, a, b)", "pa pb"), ("FOR_EACH_I(H, a, b, c)", "a = 0 b = 1 c = 2"),
+                  ("FOR_EACH_SEP(F, COMMA, a, b)", "[a] , [b]"), ("FOR_EACH_2D(FST_SND, (a, b), (c))", "a, c b, c"),
+                  ("FOR_EACH_SLICE(1, 2, F, a, b, c)", "[c]"),
+                  ("FOR_EACH_SLICE(1, 1, F, a, b) FOR_EACH_SLICE(0, 1, F, a, b)", "[a] [b]")],
+                 "FOR_EACH(F, %s)" % LIST, 10),
+    "compare": ([("EQUALS(a, a) EQUALS(a, b)", "1 0"), ("NOT_EQUALS(1, 2)", "1")],
+                "EQUALS(a, a) NOT_EQUALS(a, b)", 1000),
+    "arith": ([("INC(7) DEC(0) DEC(256)", "8 0 255"), ("ADD(100, 56) SUB(3, 5) SUB(200, 56)", "156 0 144"),
+               ("ADD(ADD(1, 2), 3) INC(DIV(6, 2))", "6 4"),
+               ("MUL(12, 12) DIV(200, 7) DIV(7, 7)", "144 28 1"), ("BINOM(6, 2)", "15"),
+               ("LESS(3, 4) LESS_EQ(4, 4) GREATER(3, 4) MAX(9, 200) MIN(9, 200)", "1 1 0 200 9")],
+              "ADD(100, 100) MUL(12, 20) DIV(255, 3)", 10),
+    "bits": ([("POPCOUNT(255) LOG2(300) NEXT_POW2(300) IS_POW2(256)", "8 8 512 1"),
+              ("SHL(3, 4) SHR(300, 2) BITAND(6, 3) BITOR(6, 3) BITXOR(5, 3)", "48 75 2 7 6")],
+             "POPCOUNT(511) SHL(1, 8) BITXOR(300, 211) LOG2(257)", 200),
+    "signed": ([("INT_ADD(NEG(3), 1) INT_LITERAL(INT_SUB(2, 5)) INT_NEG(NEG(4))", "NEG(2) -3 4"),
+                ("INT_LESS(NEG(4), NEG(3)) INT_CMP(0, NEG(1)) INT_MAX(NEG(2), NEG(9))", "1 GT NEG(2)"),
+                ("INT_RANGE(2, NEG(2), NEG(2))", "2, 0, -2")],
+               "INT_ADD(NEG(100), 60) INT_SUB(NEG(20), NEG(50)) INT_LESS(NEG(7), 3)", 20),
+    "range": ([("RANGE(0, 5, 1)", "0, 1, 2, 3, 4, 5"), ("RANGE(2, 10, 4)", "2, 6, 10"),
+               ("RANGE_SLICE(1, 3, 0, 10, 2) RANGE_SLICE(2, 3, 0, 9, 2)", "4, 6 8, 9")], "RANGE(0, 100, 1)", 10),
+    "sort": ([("SORT((3, c), (1, a), (2, b), (1, d))", "(1, a), (1, d), (2, b), (3, c)"),
+              ("SORT_DESC((3, c), (1, a), (2, b))", "(3, c), (2, b), (1, a)")],
+             "SORT(%s)" % TUPLES, 5),
+    "dict": ([("DICT_GET(D, red, 0) DICT_GET(D, blue, 0)", "0xff0000 0"),
+              ("DICT_GET(D, pair, x) DICT_GET(D, e, c, d)", "a, b c, d"),
+              ("DICT_CONTAINS(D, red) SET_CONTAINS(S, simd) SET_CONTAINS(S, avx)", "1 1 0"),
+              ("DICT_GET(D, RED, 0) DICT_CONTAINS(D, RED)", "0xff0000 1")],
+             "DICT_GET(D, red, 0) DICT_GET(D, blue, 0) SET_CONTAINS(S, simd) SET_CONTAINS(S, avx)", 2000),
+    "recur": ([("EVAL(DEFER(SND)(a, b))", "b"), ("EVAL(DEFER2(PAIR)(1, 2))", "1:2")], "RECUR(x)", 20),
+}
+
+
+def tokens(text):
+    return " ".join(TOKEN_RE.findall(text))
+
+
+def preprocess(command, flags, body, timeout):
+    """Preprocesses the prelude followed by `body`, returns (seconds, output without the breadcrumbs of MCMT_TRACE)."""
+    with tempfile.TemporaryDirectory(prefix="mcmt_matrix") as tmp:
+        probe = os.path.join(tmp, "probe.c")
+        with open(probe, "w") as f:
+            f.write(PRELUDE + body)
+        seconds, out, _ = run_cc(command[0], command[1:] + flags + [probe], timeout)
+    return seconds, "\n".join(l for l in out.splitlines() if not l.lstrip().startswith("#pragma GCC warning"))
+
+
+def check(command, flags, cases, timeout):
+    """Returns the failed cases as (invocation, expected, got). A case the preprocessor rejects is run on its own."""
+    try:
+        _, out = preprocess(command, flags, "".join("%s %s\n" % (CASE_MARK, e) for e, _ in cases), timeout)
+        got = [tokens(o) for o in out.split(CASE_MARK)[1:]]
+    except (RuntimeError, TimeoutError):
+        got = []
+    if len(got) != len(cases):
+        got = []
+        for expr, _ in cases:
+            try:
+                got.append(tokens(preprocess(command, flags, "%s %s\n" % (CASE_MARK, expr), timeout)[1]
+                                  .split(CASE_MARK, 1)[1]))
+            except (RuntimeError, TimeoutError) as e:
+                got.append("error: %s" % e)
+    return [(e, want, g) for (e, want), g in zip(cases, got) if g != tokens(want)]
+
+
+def cost(command, flags, line, count, repeat, base, timeout):
+    """Returns the fastest time to preprocess `count` copies of `line`, the inclusion of MCMT subtracted."""
+    try:
+        best = min(preprocess(command, flags, (line + "\n") * count, timeout)[0] for _ in range(repeat))
+    except TimeoutError:
+        return None
+    return max(best - base, 0.0)
+
+
+def probe_pp(command, flags, timeout):
+    """Returns what mcmt/pp.h identified: (MCMT_PP_NAME, whether a fast path is selected)."""
+    _, out = preprocess(command, flags, "%s MCMT_PP_NAME\n#if MCMT_PP_VA_OPT\nfast\n#endif\n" % CASE_MARK, timeout)
+    out = out.split(CASE_MARK, 1)[1].split()
+    return out[0].strip('"'), "fast" in out
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("families", nargs="*", help="the families of macros to run (default: all)")
+    ap.add_argument("--pp", action="append", default=[], metavar="NAME=COMMAND",
+                    help="add or replace a preprocessor, e.g. 'tcc=tcc -E -P -DNDEBUG' (repeatable)")
+    ap.add_argument("--only", help="comma-separated names of the preprocessors to run")
+    ap.add_argument("--repeat", type=int, default=3, help="runs per workload, the fastest is kept (default: 3)")
+    ap.add_argument("--timeout", type=float, default=60, help="seconds before a workload is given up (default: 60)")
+    ap.add_argument("--json", action="store_true", help="print the report as JSON")
+    opts = ap.parse_args(argv)
+
+    families = opts.families or list(FAMILIES)
+    unknown = [f for f in families if f not in FAMILIES]
+    if unknown:
+        ap.error("unknown families: %s (known: %s)" % (", ".join(unknown), " ".join(FAMILIES)))
+    pps = dict(PREPROCESSORS)
+    for spec in opts.pp:
+        name, _, command = spec.partition("=")
+        if not command:
+            ap.error("--pp expects NAME=COMMAND, got `%s`" % spec)
+        pps[name] = shlex.split(command)
+    if opts.only:
+        pps = {n: c for n, c in pps.items() if n in opts.only.split(",")}
+
+    columns, missing = [], []
+    flags = ["-I", ROOT]
+    for name, command in pps.items():
+        if not shutil.which(command[0]):
+            missing.append(name)
+            continue
+        try:
+            detected, fast = probe_pp(command, flags, opts.timeout)
+        except (RuntimeError, TimeoutError) as e:
+            missing.append("%s (%s)" % (name, e))
+            continue
+        columns.append({"name": name, "command": command, "flags": flags, "detected": detected, "fast": fast})
+        if fast:
+            columns.append({"name": name + "/portable", "command": command, "flags": flags + PORTABLE,
+                            "detected": detected, "fast": False})
+        if detected in TRACED:
+            columns.append({"name": name + "/trace", "command": command, "flags": flags + TRACE,
+                            "detected": detected, "fast": fast})
+    if not columns:
+        sys.exit("no preprocessor found (tried: %s)" % ", ".join(missing))
+
+    for col in columns:
+        col["baseline"] = min(preprocess(col["command"], col["flags"], "", opts.timeout)[0] for _ in range(opts.repeat))
+        col["families"] = {}
+        for family in families:
+            cases, line, count = FAMILIES[family]
+            failed = check(col["command"], col["flags"], cases, opts.timeout)
+            seconds = cost(col["command"], col["flags"], line, count, opts.repeat, col["baseline"], opts.timeout)
+            col["families"][family] = {"cases": len(cases), "seconds": seconds,
+                                       "failed": [{"case": e, "expected": w, "got": g} for e, w, g in failed]}
+
+    ok = all(not r["failed"] for col in columns for r in col["families"].values())
+    if opts.json:
+        json.dump({"skipped": missing, "preprocessors": columns}, sys.stdout, indent=2)
+        print()
+        return 0 if ok else 1
+
+    for col in columns:
+        print("%-16s %s (MCMT_PP_NAME %s, %s), include %.1fms" % (
+            col["name"], " ".join(col["command"] + col["flags"][2:]), col["detected"],
+            "fast paths" if col["fast"] else "portable", col["baseline"] * 1e3))
+    if missing:
+        print("skipped: %s" % ", ".join(missing))
+    print("\n%-10s" % "family" + "".join(" %16s" % col["name"] for col in columns))
+    for family in families:
+        cells = []
+        for col in columns:
+            r = col["families"][family]
+            time = "timeout" if r["seconds"] is None else "%.1fms" % (r["seconds"] * 1e3)
+            cells.append("%s %s" % ("ok" if not r["failed"] else "%d/%d FAIL" % (len(r["failed"]), r["cases"]), time))
+        print("%-10s" % family + "".join(" %16s" % c for c in cells))
+    for col in columns:
+        for family in families:
+            for f in col["families"][family]["failed"]:
+                print("%s: %s is `%s`, expected `%s`" % (col["name"], f["case"], f["got"], f["expected"]))
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,323 @@
+#!/usr/bin/env python3
+"""Macro-expansion profiler for macrometa (MCMT).
+
+Finds every top-level invocation of an MCMT macro in a translation unit, directly or through a macro of the project
+that expands to one, and measures what it costs the preprocessor on its own: wall time, number of output tokens and
+peak memory of the compiler process.
+
+Each invocation site is preprocessed in isolation. The probe file holds the preprocessing directives of the
+translation unit that precede the site (includes, defines, conditionals) followed by the invocation, and the cost of
+the same directives alone is subtracted. Sites are then ranked by time, so the invocation responsible for a slow
+translation unit shows up at the top of the report.
+
+Only the local compiler is used (GCC or Clang, through `-E`), so the tool runs offline. The peak memory is read
+from wait4() on the compiler driver and covers the whole process tree.
+
+Usage:
+    tools/mcmt_prof.py [options] file.c [-- compiler flags]
+
+For example:
+    tools/mcmt_prof.py -n 10 src/generated.c -- -I. -DNDEBUG
+"""
+
+import argparse
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+TOKEN_RE = re.compile(
+    r"""[A-Za-z_]\w*|\.?\d(?:[eEpP][+-]|[\w.])*|"(?:\\.|[^"\\\n])*"|'(?:\\.|[^'\\\n])*'"""
+    r"""|<<=|>>=|\.\.\.|->|\+\+|--|<<|>>|&&|\|\||[-+*/%&|^!=<>]=|##|\S"""
+)
+LINEMARKER_RE = re.compile(r'^#\s*\d+\s+"((?:\\.|[^"\\])*)"')
+DEFINE_RE = re.compile(r"^#\s*define\s+([A-Za-z_]\w*)(\()?")
+DIRECTIVE_RE = re.compile(r"^\s*#\s*(\w*)")
+IDENT_RE = re.compile(r"[A-Za-z_]\w*")
+ERROR_RE = re.compile(r"^(.*?:\d+(?::\d+)?): (?:fatal )?error: (.*)$")
+DEFAULT_FILTER = r"(^|[/\\])(mcmt[/\\]|macrometa\.h$)"
+
+
+class Site:
+    """A top-level macro invocation in the main file."""
+
+    def __init__(self, line, macro, text, prelude, depth):
+        self.line = line
+        self.macro = macro
+        self.text = text
+        self.prelude = prelude  # the directive lines that precede the site
+        self.depth = depth  # the conditional groups left open by the prelude
+        self.seconds = None
+        self.tokens = None
+        self.peak_kib = None
+        self.error = None
+
+
+class CompileError(RuntimeError):
+    """A failed compiler run, reported by its first error and the location of that error, when it has one."""
+
+    def __init__(self, message, location=None):
+        super().__init__("%s: %s" % (location, message) if location else message)
+        self.message = message
+        self.location = location
+
+
+def first_error(stderr, returncode):
+    """Returns the CompileError of the first `error:` line of the compiler output, or of its last line without one.
+    The last line alone is useless for GCC and Clang, which end with the caret line of the error."""
+    lines = stderr.strip().splitlines()
+    for line in lines:
+        m = ERROR_RE.match(line)
+        if m:
+            return CompileError(m.group(2), m.group(1))
+    return CompileError(lines[-1] if lines else "exit code %d" % returncode)
+
+
+def run_cc(cc, args, timeout):
+    """Runs the compiler, returns (seconds, stdout, peak rss of the process tree in KiB)."""
+    with tempfile.TemporaryFile() as out, tempfile.TemporaryFile() as err:
+        start = time.perf_counter()
+        proc = subprocess.Popen([cc] + args, stdout=out, stderr=err)
+        killer = threading.Timer(timeout, proc.kill)
+        killer.start()
+        try:
+            _, status, usage = os.wait4(proc.pid, 0)
+        finally:
+            killer.cancel()
+        elapsed = time.perf_counter() - start
+        proc.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, "waitstatus_to_exitcode") else status
+        if os.WIFSIGNALED(status):
+            raise TimeoutError("timed out after %gs" % timeout)
+        out.seek(0)
+        err.seek(0)
+        if proc.returncode != 0:
+            raise first_error(err.read().decode(errors="replace"), proc.returncode)
+        return elapsed, out.read().decode(errors="replace"), usage.ru_maxrss
+
+
+def measure(cc, flags, path, timeout, repeat):
+    """Preprocesses `path` `repeat` times, returns the fastest time, its token count and the highest peak memory."""
+    best_time, tokens, peak = None, 0, 0
+    for _ in range(repeat):
+        elapsed, out, rss = run_cc(cc, ["-E", "-P"] + flags + [path], timeout)
+        peak = max(peak, rss)
+        if best_time is None or elapsed < best_time:
+            best_time, tokens = elapsed, len(TOKEN_RE.findall(out))
+    return best_time, tokens, peak
+
+
+def collect_macros(cc, flags, path, pattern, everything):
+    """Returns the macros to profile, as two sets: the function-like macros defined in headers matching `pattern`
+    and the other function-like macros that expand to them, then the object-like macros that expand to them, like
+    `#define TABLE RANGE(0, 60, 1)`. Invocations through user-defined wrappers of either kind are attributed too."""
+    args = ["-E", "-dD"] + flags + [path]
+    try:
+        _, out, _ = run_cc(cc, ["-fdirectives-only"] + args, 600)
+    except RuntimeError:  # Clang has no -fdirectives-only
+        _, out, _ = run_cc(cc, args, 600)
+    matched, others, current = set(), {}, ""
+    for line in out.splitlines():
+        marker = LINEMARKER_RE.match(line)
+        if marker:
+            current = marker.group(1)
+            continue
+        define = DEFINE_RE.match(line)
+        if not define:
+            continue
+        if everything or re.search(pattern, current.replace("\\\\", "\\")):
+            if define.group(2):
+                matched.add(define.group(1))
+        else:
+            others[define.group(1)] = (bool(define.group(2)), set(IDENT_RE.findall(line[define.end() :])))
+    uses, changed = set(matched), True
+    while changed:
+        changed = False
+        for name, (_, body) in others.items():
+            if name not in uses and body & uses:
+                uses.add(name)
+                changed = True
+    wrappers = uses - matched
+    return matched | {name for name in wrappers if others[name][0]}, {name for name in wrappers if not others[name][0]}
+
+
+def strip_comments(src, mask_literals=False):
+    """Blanks out comments, and the contents of literals if asked, keeping every offset and line number."""
+    out, i, n = [], 0, len(src)
+    while i < n:
+        c = src[i]
+        if src.startswith("//", i):
+            j = src.find("\n", i)
+            i = n if j < 0 else j
+        elif src.startswith("/*", i):
+            j = src.find("*/", i + 2)
+            j = n if j < 0 else j + 2
+            out.append(re.sub(r"[^\n]", " ", src[i:j]))
+            i = j
+        elif c in "\"'":
+            j = i + 1
+            while j < n and src[j] != c and src[j] != "\n":
+                j += 2 if src[j] == "\\" else 1
+            literal = src[i : j + 1]
+            out.append(c + " " * (len(literal) - 2) + literal[-1] if mask_literals and len(literal) > 1 else literal)
+            i = j + 1
+        else:
+            out.append(c)
+            i += 1
+    return "".join(out)
+
+
+def find_sites(src, macros, objects=()):
+    """Splits the main file into directive lines and code, and returns the top-level invocations of the function-like
+    `macros` and the uses of the object-like `objects`, with the parenthesized arguments that may follow them."""
+    lines = strip_comments(src).split("\n")
+    masked = strip_comments(src, True).split("\n")  # scanned, so that identifiers in literals are not matched
+    sites, prelude, depth = [], [], 0
+    code = []  # (line number, text, masked text) of the code lines, scanned at the next directive or at the end
+
+    def scan(code):
+        text = "\n".join(t for _, t, _ in code)
+        scanned = "\n".join(m for _, _, m in code)
+        starts = [ln for ln, _, _ in code]
+        pos = 0
+        while True:
+            m = IDENT_RE.search(scanned, pos)
+            if not m:
+                return
+            pos = m.end()
+            if m.group(0) not in macros and m.group(0) not in objects:
+                continue
+            j = pos
+            while j < len(scanned) and scanned[j].isspace():
+                j += 1
+            if j >= len(scanned) or scanned[j] != "(":
+                if m.group(0) in objects:
+                    line = starts[scanned.count("\n", 0, m.start())]
+                    sites.append(Site(line, m.group(0), m.group(0), list(prelude), depth))
+                continue
+            level, k = 0, j
+            while k < len(scanned):
+                level += {"(": 1, ")": -1}.get(scanned[k], 0)
+                if level == 0:
+                    break
+                k += 1
+            line = starts[scanned.count("\n", 0, m.start())]
+            sites.append(Site(line, m.group(0), text[m.start() : k + 1], list(prelude), depth))
+            pos = k + 1
+
+    i = 0
+    while i < len(lines):
+        line, mask, number = lines[i], masked[i], i + 1
+        while line.endswith("\\") and i + 1 < len(lines):
+            i += 1
+            line = line + "\n" + lines[i]
+            mask = mask + "\n" + masked[i]
+        directive = DIRECTIVE_RE.match(line)
+        if directive:
+            scan(code)
+            code = []
+            prelude.append(line)
+            name = directive.group(1)
+            depth += 1 if name in ("if", "ifdef", "ifndef") else -1 if name == "endif" else 0
+        else:
+            code.append((number, line, mask))
+        i += 1
+    scan(code)
+    return sites
+
+
+def probe_source(prelude, depth, text):
+    return "\n".join(prelude + ["", text] + ["#endif"] * depth) + "\n"
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("file", help="the translation unit to profile")
+    ap.add_argument("flags", nargs="*", help="compiler flags, after `--`")
+    ap.add_argument("-n", "--top", type=int, default=20, help="number of sites to report (default: 20)")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="the compiler (default: $CC or cc)")
+    ap.add_argument("--repeat", type=int, default=3, help="runs per measurement, the fastest is kept (default: 3)")
+    ap.add_argument("--timeout", type=float, default=120, help="seconds before a site is given up (default: 120)")
+    ap.add_argument("--filter", default=DEFAULT_FILTER, help="regex on the header path of profiled macros")
+    ap.add_argument("--all", action="store_true", help="profile invocations of every function-like macro")
+    ap.add_argument("--json", action="store_true", help="print the report as JSON")
+    opts = ap.parse_args(argv)
+
+    path = os.path.abspath(opts.file)
+    flags = ["-iquote", os.path.dirname(path)] + opts.flags
+    with open(path, encoding="utf-8", errors="replace") as f:
+        src = f.read()
+
+    total, total_tokens, total_peak = measure(opts.cc, flags, path, opts.timeout * 10, 1)
+    macros, objects = collect_macros(opts.cc, flags, path, opts.filter, opts.all)
+    sites = find_sites(src, macros, objects)
+
+    baselines = {}
+    with tempfile.TemporaryDirectory(prefix="mcmt_prof") as tmp:
+        probe = os.path.join(tmp, "probe.c")
+        for site in sites:
+            key = (len(site.prelude), site.depth)
+            try:
+                if key not in baselines:
+                    with open(probe, "w") as f:
+                        f.write(probe_source(site.prelude, site.depth, ""))
+                    baselines[key] = measure(opts.cc, flags, probe, opts.timeout, opts.repeat)
+                base_time, base_tokens, _ = baselines[key]
+                with open(probe, "w") as f:
+                    f.write(probe_source(site.prelude, site.depth, site.text))
+                elapsed, tokens, peak = measure(opts.cc, flags, probe, opts.timeout, opts.repeat)
+                site.seconds = max(elapsed - base_time, 0.0)
+                site.tokens = max(tokens - base_tokens, 0)
+                site.peak_kib = peak
+            except (RuntimeError, TimeoutError) as e:
+                site.error = str(e)
+                site.seconds = opts.timeout if isinstance(e, TimeoutError) else 0.0
+
+    ranked = sorted(sites, key=lambda s: s.seconds, reverse=True)[: opts.top]
+    summary = {
+        "file": opts.file,
+        "total_seconds": total,
+        "total_tokens": total_tokens,
+        "total_peak_kib": total_peak,
+        "sites": len(sites),
+        "site_seconds": sum(s.seconds for s in sites),
+    }
+    if opts.json:
+        summary["top"] = [
+            {
+                "line": s.line,
+                "macro": s.macro,
+                "seconds": s.seconds,
+                "tokens": s.tokens,
+                "peak_kib": s.peak_kib,
+                "error": s.error,
+                "text": s.text,
+            }
+            for s in ranked
+        ]
+        json.dump(summary, sys.stdout, indent=2)
+        print()
+        return 0
+
+    print("%s: %.3fs, %d tokens, %.1f MiB peak in the preprocessor (%s)"
+          % (opts.file, total, total_tokens, total_peak / 1024.0, " ".join(shlex.quote(a) for a in [opts.cc] + opts.flags)))
+    print("%d MCMT invocation sites, %.3fs when preprocessed one by one\n" % (len(sites), summary["site_seconds"]))
+    print("%4s %9s %6s %10s %9s  %-6s %-24s %s" % ("rank", "time", "share", "tokens", "peak", "line", "macro", "invocation"))
+    for rank, s in enumerate(ranked, 1):
+        snippet = " ".join(s.text.split())
+        snippet = snippet if len(snippet) <= 48 else snippet[:45] + "..."
+        if s.error:
+            print("%4d %9s %6s %10s %9s  %-6d %-24s %s  [%s]" % (rank, "-", "-", "-", "-", s.line, s.macro, snippet, s.error))
+            continue
+        share = 100.0 * s.seconds / total if total else 0.0
+        print("%4d %8.1fms %5.1f%% %10d %7.1fMiB  %-6d %-24s %s"
+              % (rank, s.seconds * 1e3, share, s.tokens, s.peak_kib / 1024.0, s.line, s.macro, snippet))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
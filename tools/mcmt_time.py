@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Preprocessing time of macrometa (MCMT) invocations, before and after a change.
+
+Preprocesses a translation unit that includes `macrometa.h` and repeats one invocation, for every invocation given,
+and reports the fastest time over a few runs with the time of the bare include subtracted. With `--against REV`, the
+headers of the git revision REV are measured as well, so the report compares a change to the revision it started
+from. An invocation that does not finish within the timeout, or fails to expand, is reported as such instead of
+stopping the run.
+
+Usage:
+    tools/mcmt_time.py [options] invocation ... [-- compiler flags]
+
+For example:
+    tools/mcmt_time.py --against HEAD~1 -n 5 "RANGE(0, 100, 1)" "DIV(200, 7)"
+"""
+
+import argparse
+import io
+import os
+import re
+import subprocess
+import sys
+import tarfile
+import tempfile
+
+from mcmt_prof import run_cc
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE_RE = re.compile(r'^\s*#\s*include\s*"[^"]*"', re.M)
+
+
+def checkout(rev, dest):
+    """Extracts the headers of the library at the git revision `rev` into `dest`. Revisions before the split of
+    mcmt.h spelled their includes with backslashes, which are turned into slashes so they build on every host."""
+    archive = subprocess.run(["git", "-C", ROOT, "archive", rev, "macrometa.h", "mcmt"], stdout=subprocess.PIPE,
+                             check=True).stdout
+    with tarfile.open(fileobj=io.BytesIO(archive)) as tar:
+        tar.extractall(dest)
+    for parent, _, names in os.walk(dest):
+        for name in names:
+            path = os.path.join(parent, name)
+            with open(path, encoding="utf-8", errors="surrogateescape") as f:
+                text = f.read()
+            fixed = INCLUDE_RE.sub(lambda m: m.group(0).replace("\\", "/"), text)
+            if fixed != text:
+                with open(path, "w", encoding="utf-8", errors="surrogateescape") as f:
+                    f.write(fixed)
+
+
+def timing(cc, flags, tree, body, copies, repeat, timeout):
+    """Returns the fastest time to preprocess `copies` lines of `body` with the headers of `tree`, or an error."""
+    with tempfile.TemporaryDirectory(prefix="mcmt_time") as tmp:
+        probe = os.path.join(tmp, "probe.c")
+        with open(probe, "w") as f:
+            f.write('#include "macrometa.h"\n' + (body + "\n") * copies)
+        try:
+            return min(run_cc(cc, ["-E", "-P", "-I", tree] + flags + [probe], timeout)[0] for _ in range(repeat))
+        except TimeoutError:
+            return "did not finish in %gs" % timeout
+        except RuntimeError as e:
+            return "failed: %s" % e
+
+
+def main(argv):
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("invocations", nargs="+", help="the invocations to time, e.g. 'ADD(200, 50)'")
+    ap.add_argument("--against", metavar="REV", help="also time the headers of this git revision")
+    ap.add_argument("--cc", default=os.environ.get("CC", "cc"), help="the compiler (default: $CC or cc)")
+    ap.add_argument("-n", "--copies", type=int, default=10, help="copies of each invocation (default: 10)")
+    ap.add_argument("--repeat", type=int, default=3, help="runs per invocation, the fastest is kept (default: 3)")
+    ap.add_argument("--timeout", type=float, default=60, help="seconds before an invocation is given up (default: 60)")
+    opts, flags = ap.parse_known_args(argv)
+    flags = [f for f in flags if f != "--"]
+
+    with tempfile.TemporaryDirectory(prefix="mcmt_rev") as old:
+        trees = [("working tree", ROOT)]
+        if opts.against:
+            checkout(opts.against, old)
+            trees.insert(0, (opts.against, old))
+        bases = [timing(opts.cc, flags, tree, "", 0, opts.repeat, opts.timeout) for _, tree in trees]
+        print("%s -E, %d copies per invocation\n" % (" ".join([opts.cc] + flags), opts.copies))
+        print("%-32s %s" % ("invocation", "".join("%-24s" % name for name, _ in trees)))
+        for body in opts.invocations:
+            cells = []
+            for (_, tree), base in zip(trees, bases):
+                t = timing(opts.cc, flags, tree, body, opts.copies, opts.repeat, opts.timeout)
+                cells.append("%.2fs" % max(t - base, 0.0) if isinstance(t, float) else t)
+            print("%-32s %s" % (body, "".join("%-24s" % c for c in cells)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))